@@ -0,0 +1,305 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "BinaryDataFile.h"
+#include "DataSetInfo.h"
+
+#include <QFile>
+#include <QHash>
+#include <QVector>
+
+#include <float.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static const char MAGIC[8] = { 'L', 'G', 'B', 'I', 'N', 'A', 'R', 'Y' };
+// Number of values buffered before each column write.
+static const int WRITE_BLOCK = 65536;
+
+const char* BinaryDataFile::EXTENSION = ".lgb";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool BinaryDataFile::IsBinaryFile(const QString& fileName)
+{
+	return fileName.endsWith(EXTENSION, Qt::CaseInsensitive);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int BinaryDataFile::Write(DataSet* data, DataSet::SubsetType subset, const QString& fileName)
+{
+	QFile file(fileName);
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return -1;
+
+	DataSetInfo* info = data->GetInfo();
+	int numRows = data->GetDataLength(subset);
+	int numFields = info->GetNumFields();
+
+	FileHeader header;
+	memset(&header, 0, sizeof(FileHeader));
+	memcpy(header.Magic, MAGIC, sizeof(MAGIC));
+	header.Version = VERSION;
+	header.NumRows = numRows;
+	header.NumFields = numFields;
+	header.TagLength = TAG_LEN;
+	if(numRows > 0)
+	{
+		header.TimestampRange[0] = data->GetData(0, subset)->Timestamp;
+		header.TimestampRange[1] = header.TimestampRange[0];
+	}
+
+	QVector<FieldHeader> fields(numFields);
+	memset(fields.data(), 0, sizeof(FieldHeader) * numFields);
+	QVector<TagHeader> tags(NUM_TAGS);
+	memset(tags.data(), 0, sizeof(TagHeader) * NUM_TAGS);
+
+	// Headers are written again once the section offsets and ranges are known.
+	file.write((const char*)&header, sizeof(FileHeader));
+	file.write((const char*)fields.constData(), sizeof(FieldHeader) * numFields);
+	file.write((const char*)tags.constData(), sizeof(TagHeader) * NUM_TAGS);
+	WritePadding(&file);
+
+	// Timestamps.
+	QVector<qint64> timestamps(WRITE_BLOCK);
+	header.TimestampOffset = file.pos();
+	for(int start = 0; start < numRows; start += WRITE_BLOCK)
+	{
+		int end = qMin(start + WRITE_BLOCK, numRows);
+		for(int i = start; i < end; i++)
+		{
+			qint64 t = data->GetData(i, subset)->Timestamp;
+			if(t < header.TimestampRange[0]) header.TimestampRange[0] = t;
+			if(t > header.TimestampRange[1]) header.TimestampRange[1] = t;
+			timestamps[i - start] = t;
+		}
+		file.write((const char*)timestamps.constData(), sizeof(qint64) * (end - start));
+	}
+	WritePadding(&file);
+
+	// Field columns.
+	QVector<float> values(WRITE_BLOCK);
+	for(int j = 0; j < numFields; j++)
+	{
+		FieldInfo* fi = info->GetField(j);
+		FieldHeader& fh = fields[j];
+		SetString(fh.Name, fi->GetName().toUtf8());
+		SetString(fh.Label, fi->GetLabel().toUtf8());
+		fh.Type = Float32;
+		fh.Range[0] = FLT_MAX;
+		fh.Range[1] = -FLT_MAX;
+		fh.Offset = file.pos();
+
+		for(int start = 0; start < numRows; start += WRITE_BLOCK)
+		{
+			int end = qMin(start + WRITE_BLOCK, numRows);
+			for(int i = start; i < end; i++)
+			{
+				float value = data->GetData(i, subset)->Field[j];
+				if(value < fh.Range[0]) fh.Range[0] = value;
+				if(value > fh.Range[1]) fh.Range[1] = value;
+				values[i - start] = value;
+			}
+			file.write((const char*)values.constData(), sizeof(float) * (end - start));
+		}
+		WritePadding(&file);
+	}
+
+	// Tag index columns and dictionaries. Dictionary entries are stored in order of first appearance.
+	string tagLabels[NUM_TAGS] = { info->GetTag1Label(), info->GetTag2Label(), info->GetTag3Label(), info->GetTag4Label() };
+	QVector<quint32> indices(WRITE_BLOCK);
+	for(int t = 0; t < NUM_TAGS; t++)
+	{
+		TagHeader& th = tags[t];
+		SetString(th.Label, QByteArray(tagLabels[t].c_str()));
+		th.IndexOffset = file.pos();
+
+		QHash<QByteArray, quint32> entryIds;
+		QByteArray dictionary;
+		for(int start = 0; start < numRows; start += WRITE_BLOCK)
+		{
+			int end = qMin(start + WRITE_BLOCK, numRows);
+			for(int i = start; i < end; i++)
+			{
+				const char* tag = data->GetData(i, subset)->GetTag((DataSetInfo::TagId)t);
+				QByteArray entry(tag, qstrnlen(tag, TAG_LEN));
+
+				QHash<QByteArray, quint32>::const_iterator it = entryIds.constFind(entry);
+				if(it == entryIds.constEnd())
+				{
+					it = entryIds.insert(entry, entryIds.size());
+					entry.append(QByteArray(TAG_LEN - entry.size(), '\0'));
+					dictionary.append(entry);
+				}
+				indices[i - start] = it.value();
+			}
+			file.write((const char*)indices.constData(), sizeof(quint32) * (end - start));
+		}
+		WritePadding(&file);
+
+		th.NumEntries = entryIds.size();
+		th.DictionaryOffset = file.pos();
+		file.write(dictionary);
+		WritePadding(&file);
+	}
+
+	// Rewrite the completed headers.
+	file.seek(0);
+	file.write((const char*)&header, sizeof(FileHeader));
+	file.write((const char*)fields.constData(), sizeof(FieldHeader) * numFields);
+	file.write((const char*)tags.constData(), sizeof(TagHeader) * NUM_TAGS);
+
+	file.close();
+	return file.error() == QFile::NoError ? numRows : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BinaryDataFile::BinaryDataFile():
+	myFile(NULL),
+	myData(NULL),
+	mySize(0),
+	myHeader(NULL),
+	myFields(NULL),
+	myTags(NULL)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BinaryDataFile::~BinaryDataFile()
+{
+	Close();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool BinaryDataFile::Open(QFile* file)
+{
+	Close();
+
+	mySize = file->size();
+	if(mySize < (qint64)sizeof(FileHeader)) return false;
+
+	myData = file->map(0, mySize);
+	if(myData == NULL) return false;
+	myFile = file;
+
+	myHeader = (const FileHeader*)myData;
+	if(memcmp(myHeader->Magic, MAGIC, sizeof(MAGIC)) != 0 || myHeader->Version != VERSION || myHeader->TagLength == 0)
+	{
+		Close();
+		return false;
+	}
+
+	quint64 numRows = myHeader->NumRows;
+	quint64 numFields = myHeader->NumFields;
+	if(!CheckSection(sizeof(FileHeader), numFields * sizeof(FieldHeader) + NUM_TAGS * sizeof(TagHeader)) ||
+		!CheckSection(myHeader->TimestampOffset, numRows * sizeof(qint64)))
+	{
+		Close();
+		return false;
+	}
+	myFields = (const FieldHeader*)(myData + sizeof(FileHeader));
+	myTags = (const TagHeader*)(myData + sizeof(FileHeader) + numFields * sizeof(FieldHeader));
+
+	for(quint64 j = 0; j < numFields; j++)
+	{
+		if(myFields[j].Type != Float32 || !CheckSection(myFields[j].Offset, numRows * sizeof(float)))
+		{
+			Close();
+			return false;
+		}
+	}
+
+	for(int t = 0; t < NUM_TAGS; t++)
+	{
+		const TagHeader& th = myTags[t];
+		if(!CheckSection(th.IndexOffset, numRows * sizeof(quint32)) ||
+			!CheckSection(th.DictionaryOffset, (quint64)th.NumEntries * myHeader->TagLength))
+		{
+			Close();
+			return false;
+		}
+
+		// Make sure all the indices point inside the dictionary.
+		const quint32* indices = GetTagIndices(t);
+		for(quint64 i = 0; i < numRows; i++)
+		{
+			if(indices[i] >= th.NumEntries)
+			{
+				Close();
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void BinaryDataFile::Close()
+{
+	if(myData != NULL)
+	{
+		myFile->unmap(myData);
+	}
+	myFile = NULL;
+	myData = NULL;
+	mySize = 0;
+	myHeader = NULL;
+	myFields = NULL;
+	myTags = NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int BinaryDataFile::FindField(const QString& name)
+{
+	for(int j = 0; j < GetNumFields(); j++)
+	{
+		if(GetFieldName(j) == name) return j;
+	}
+	return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void BinaryDataFile::SetString(char* str, const QByteArray& value)
+{
+	memset(str, 0, NAME_LEN);
+	memcpy(str, value.constData(), qMin(value.size(), NAME_LEN - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void BinaryDataFile::WritePadding(QFile* file)
+{
+	static const char zeros[8] = { 0 };
+	int padding = (int)((8 - file->pos() % 8) % 8);
+	if(padding > 0) file->write(zeros, padding);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool BinaryDataFile::CheckSection(quint64 offset, quint64 size)
+{
+	return offset % 8 == 0 && offset <= (quint64)mySize && size <= (quint64)mySize - offset;
+}
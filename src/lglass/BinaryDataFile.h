@@ -0,0 +1,133 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef BINARYDATAFILE_H
+#define BINARYDATAFILE_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Binary columnar data file (.lgb). The file starts with a FileHeader, followed by one FieldHeader per field and 
+// one TagHeader per tag. Then come the timestamp column (int64), the field columns (float32), and for each tag a
+// column of dictionary indices (uint32) followed by the tag dictionary (fixed size entries of TagLength bytes).
+// Every section starts at an 8 byte aligned offset, so a mapped file can be accessed in place. Values are stored
+// in native (little endian) byte order.
+class BinaryDataFile
+{
+public:
+	static const char* EXTENSION;
+	static const quint32 VERSION = 1;
+	static const int NUM_TAGS = 4;
+	static const int NAME_LEN = 64;
+
+	enum ColumnType { Float32 = 1 };
+
+	struct FileHeader
+	{
+		char Magic[8];
+		quint32 Version;
+		quint32 NumRows;
+		quint32 NumFields;
+		quint32 TagLength;
+		qint64 TimestampRange[2];
+		quint64 TimestampOffset;
+	};
+
+	struct FieldHeader
+	{
+		char Name[NAME_LEN];
+		char Label[NAME_LEN];
+		quint32 Type;
+		quint32 Reserved;
+		double Range[2];
+		quint64 Offset;
+	};
+
+	struct TagHeader
+	{
+		char Label[NAME_LEN];
+		quint32 NumEntries;
+		quint32 Reserved;
+		quint64 IndexOffset;
+		quint64 DictionaryOffset;
+	};
+
+public:
+	// Returns true if the file name has the binary data file extension.
+	static bool IsBinaryFile(const QString& fileName);
+	// Writes the timestamp, the four tags and all the fields of the rows in the subset. Returns the number
+	// of written rows, or -1 if the file could not be written.
+	static int Write(DataSet* data, DataSet::SubsetType subset, const QString& fileName);
+
+public:
+	BinaryDataFile();
+	~BinaryDataFile();
+
+	// Maps an open file and validates its layout. Returns false if the file is not a valid binary data file.
+	bool Open(QFile* file);
+	void Close();
+
+	int GetNumRows() { return myHeader->NumRows; }
+	int GetNumFields() { return myHeader->NumFields; }
+	int GetTagLength() { return myHeader->TagLength; }
+	const qint64* GetTimestampRange() { return myHeader->TimestampRange; }
+	const qint64* GetTimestamps() { return (const qint64*)(myData + myHeader->TimestampOffset); }
+
+	// Returns the index of the field with the specified name, or -1 if the file does not contain it.
+	int FindField(const QString& name);
+	QString GetFieldName(int index) { return GetString(myFields[index].Name); }
+	QString GetFieldLabel(int index) { return GetString(myFields[index].Label); }
+	const double* GetFieldRange(int index) { return myFields[index].Range; }
+	const float* GetFieldColumn(int index) { return (const float*)(myData + myFields[index].Offset); }
+
+	QString GetTagLabel(int tag) { return GetString(myTags[tag].Label); }
+	int GetTagDictionarySize(int tag) { return myTags[tag].NumEntries; }
+	// Returns a dictionary entry. Entries are zero padded, but not zero terminated when they fill TagLength bytes.
+	const char* GetTagEntry(int tag, int entry) { return (const char*)(myData + myTags[tag].DictionaryOffset) + entry * myHeader->TagLength; }
+	const quint32* GetTagIndices(int tag) { return (const quint32*)(myData + myTags[tag].IndexOffset); }
+
+private:
+	static QString GetString(const char* str) { return QString::fromUtf8(str, qstrnlen(str, NAME_LEN)); }
+	static void SetString(char* str, const QByteArray& value);
+	static void WritePadding(QFile* file);
+	bool CheckSection(quint64 offset, quint64 size);
+
+private:
+	QFile* myFile;
+	uchar* myData;
+	qint64 mySize;
+	const FileHeader* myHeader;
+	const FieldHeader* myFields;
+	const TagHeader* myTags;
+};
+
+#endif
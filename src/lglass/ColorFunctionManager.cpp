@@ -1,156 +1,295 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "ColorFunctionManager.h"
-#include "DataSet.h"
-#include "VisualizationManager.h"
-
-#include "pqColorMapWidget.h"
-#include "pqColorMapModel.h"
-#include "pqChartValue.h"
-
-#include <QColorDIalog>
-
-#include <vtkColorTransferFunction.h>
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-ColorFunctionManager::ColorFunctionManager(VisualizationManager* mng): 
-	DockedTool(mng, "Color Function Manager", Qt::RightDockWidgetArea)
-{
-	myVizMng = mng;
-	DataSet* data = mng->GetDataSet();
-	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
-	{
-		myFunc[i] = vtkColorTransferFunction::New();
-		myNoInvalidFunc[i] = vtkColorTransferFunction::New();
-		myModel[i] = new pqColorMapModel();
-		myModel[i]->setColorSpaceFromInt(0);
-	}
-	GetMenuAction()->setIcon(QIcon(":/icons/ColorFunctionManager.png"));
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-ColorFunctionManager::~ColorFunctionManager()
-{
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ColorFunctionManager::Initialize()
-{
-	DataSet* data = myVizMng->GetDataSet();
-	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
-	{
-		float* range = data->GetFieldRange(i);
-		myModel[i]->addPoint(range[0], QColor(0, 0, 255));
-		myModel[i]->addPoint(range[1], QColor(255, 0, 0));
-		UpdateColorFunction(i);
-	}
-
-	SetupUI();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ColorFunctionManager::SetupUI()
-{
-	myUI = new Ui::ColorFunctionManagerDock();
-	myUI->setupUi(GetDockWidget());
-	myUI->verticalLayout->setMargin(0);
-
-	for(int i = 0; i < myVizMng->GetDataSet()->GetInfo()->GetNumFields(); i++)
-	{
-		myFieldLabel[i] = new QLabel(myUI->scrollArea);
-		myFieldLabel[i]->setText(myVizMng->GetDataSet()->GetFieldName(i));
-		myUI->verticalLayout_2->addWidget(myFieldLabel[i]);
-		
-		myWidget[i] = new pqColorMapWidget(myUI->scrollArea);
-		myWidget[i]->setModel(myModel[i]);
-		myWidget[i]->setMinimumHeight(32);
-		myWidget[i]->setMaximumHeight(32);
-		myUI->verticalLayout_2->addWidget(myWidget[i]);
-
-		QObject::connect(myWidget[i], SIGNAL(pointMoved(int)),
-			SLOT(OnColorTransferPointMove(int)));
-		QObject::connect(myWidget[i], SIGNAL(colorChangeRequested(int)),
-			SLOT(OnColorTransferPointChange(int)));
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ColorFunctionManager::UpdateColorFunction(int index)
-{
-	pqColorMapModel* cmodel = myModel[index];
-	
-	vtkColorTransferFunction* colorTrans = myFunc[index];
-	colorTrans->RemoveAllPoints(); 
-
-	for(int i = 0; i < cmodel->getNumberOfPoints(); i++)
-	{
-		QColor color;
-		pqChartValue val;
-		cmodel->getPointValue(i, val);
-		cmodel->getPointColor(i, color);
-		double actualValue = val.getDoubleValue();
-		colorTrans->AddRGBPoint(actualValue, color.redF(), color.greenF(), color.blueF());
-	}
-	
-	myNoInvalidFunc[index]->DeepCopy(colorTrans);
-	
-	//colorTrans->AddRGBPoint(DataSet::InvalidValue, 0, 0, 0);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ColorFunctionManager::OnColorTransferPointChange(int pt)
-{
-	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
-	{
-		if(myWidget[i] == sender())
-		{
-			QColor color = QColorDialog::getColor();
-			myModel[i]->setPointColor(pt, color);
-			UpdateColorFunction(i);
-			break;
-		}
-	}
-	GetVisualizationManager()->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ColorFunctionManager::OnColorTransferPointMove(int pt)
-{
-	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
-	{
-		if(myWidget[i] == sender())
-		{
-			UpdateColorFunction(i);
-			break;
-		}
-	}
-	GetVisualizationManager()->Render();
-}
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "ColorFunctionManager.h"
+#include "DataSet.h"
+#include "VisualizationManager.h"
+
+#include "pqColorMapWidget.h"
+#include "pqColorMapModel.h"
+#include "pqChartValue.h"
+
+#include <QColorDIalog>
+
+#include <vtkColorTransferFunction.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+const unsigned char ColorFunctionManager::BRUSH_COLOR[4] = { 255, 255, 0, 255 };
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ColorFunctionManager::ColorFunctionManager(VisualizationManager* mng): 
+	DockedTool(mng, "Color Function Manager", Qt::RightDockWidgetArea)
+{
+	myVizMng = mng;
+	DataSet* data = mng->GetDataSet();
+	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
+	{
+		myFunc[i] = vtkColorTransferFunction::New();
+		myNoInvalidFunc[i] = vtkColorTransferFunction::New();
+		myModel[i] = new pqColorMapModel();
+		myModel[i]->setColorSpaceFromInt(0);
+	}
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		myLookupIndex[i] = NULL;
+		myColorArray[i] = NULL;
+	}
+	GetMenuAction()->setIcon(QIcon(":/icons/ColorFunctionManager.png"));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ColorFunctionManager::~ColorFunctionManager()
+{
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		delete[] myLookupIndex[i];
+		if(myColorArray[i] != NULL) myColorArray[i]->Delete();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::Initialize()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
+	{
+		float* range = data->GetFieldRange(i);
+		myModel[i]->addPoint(range[0], QColor(0, 0, 255));
+		myModel[i]->addPoint(range[1], QColor(255, 0, 0));
+		UpdateColorFunction(i);
+	}
+
+	data->AddListener(this, DataSet::FieldValuesChanged | DataSet::FieldRangeChanged | DataSet::BrushChanged);
+
+	SetupUI();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::SetupUI()
+{
+	myUI = new Ui::ColorFunctionManagerDock();
+	myUI->setupUi(GetDockWidget());
+	myUI->verticalLayout->setMargin(0);
+
+	for(int i = 0; i < myVizMng->GetDataSet()->GetInfo()->GetNumFields(); i++)
+	{
+		myFieldLabel[i] = new QLabel(myUI->scrollArea);
+		myFieldLabel[i]->setText(myVizMng->GetDataSet()->GetFieldName(i));
+		myUI->verticalLayout_2->addWidget(myFieldLabel[i]);
+		
+		myWidget[i] = new pqColorMapWidget(myUI->scrollArea);
+		myWidget[i]->setModel(myModel[i]);
+		myWidget[i]->setMinimumHeight(32);
+		myWidget[i]->setMaximumHeight(32);
+		myUI->verticalLayout_2->addWidget(myWidget[i]);
+
+		QObject::connect(myWidget[i], SIGNAL(pointMoved(int)),
+			SLOT(OnColorTransferPointMove(int)));
+		QObject::connect(myWidget[i], SIGNAL(colorChangeRequested(int)),
+			SLOT(OnColorTransferPointChange(int)));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::UpdateColorFunction(int index)
+{
+	pqColorMapModel* cmodel = myModel[index];
+	
+	vtkColorTransferFunction* colorTrans = myFunc[index];
+	colorTrans->RemoveAllPoints(); 
+
+	for(int i = 0; i < cmodel->getNumberOfPoints(); i++)
+	{
+		QColor color;
+		pqChartValue val;
+		cmodel->getPointValue(i, val);
+		cmodel->getPointColor(i, color);
+		double actualValue = val.getDoubleValue();
+		colorTrans->AddRGBPoint(actualValue, color.redF(), color.greenF(), color.blueF());
+	}
+	
+	myNoInvalidFunc[index]->DeepCopy(colorTrans);
+	
+	//colorTrans->AddRGBPoint(DataSet::InvalidValue, 0, 0, 0);
+
+	// Refresh the baked colors. Only the table and the color array change: the data pipeline is not
+	// touched.
+	BakeLookupTable(index);
+	if(myColorArray[index] != NULL) UpdateColorArray(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::BakeLookupTable(int index)
+{
+	float* range = myVizMng->GetDataSet()->GetFieldRange(index);
+
+	double table[LUT_SIZE * 3];
+	myFunc[index]->GetTable(range[0], range[1], LUT_SIZE, table);
+
+	for(int i = 0; i < LUT_SIZE; i++)
+	{
+		unsigned char* rgba = (unsigned char*)&myLookupTable[index][i];
+		rgba[0] = (unsigned char)(table[i * 3] * 255 + 0.5);
+		rgba[1] = (unsigned char)(table[i * 3 + 1] * 255 + 0.5);
+		rgba[2] = (unsigned char)(table[i * 3 + 2] * 255 + 0.5);
+		rgba[3] = 255;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+vtkUnsignedCharArray* ColorFunctionManager::GetColorArray(int index)
+{
+	if(myColorArray[index] == NULL)
+	{
+		int n = myVizMng->GetDataSet()->GetDataLength(DataSet::AllData);
+
+		myLookupIndex[index] = new unsigned short[n];
+		UpdateLookupIndex(index);
+
+		myColorArray[index] = vtkUnsignedCharArray::New();
+		myColorArray[index]->SetName("Colors");
+		myColorArray[index]->SetNumberOfComponents(4);
+		myColorArray[index]->SetNumberOfTuples(n);
+
+		UpdateColorArray(index);
+	}
+	return myColorArray[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::UpdateLookupIndex(int index)
+{
+	// Quantize the field values to lookup table indices. This only depends on the data, so it is
+	// only redone when the field values change.
+	DataSet* data = myVizMng->GetDataSet();
+	int n = data->GetDataLength(DataSet::AllData);
+	float* range = data->GetFieldRange(index);
+	float* column = data->GetFieldColumn(index);
+	float scale = range[1] > range[0] ? (LUT_SIZE - 1) / (range[1] - range[0]) : 0;
+	float minValue = range[0];
+
+	unsigned short* lutIndex = myLookupIndex[index];
+	for(int i = 0; i < n; i++)
+	{
+		float t = (column[i] - minValue) * scale + 0.5f;
+		// NaN values fail the first comparison and map to the first table entry.
+		t = !(t > 0) ? 0 : (t > LUT_SIZE - 1 ? LUT_SIZE - 1 : t);
+		lutIndex[i] = (unsigned short)t;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::OnDataSetChanged(DataSet::ChangeType change, int field)
+{
+	if(change == DataSet::BrushChanged)
+	{
+		// Only the highlighted rows change: the lookup indices are still valid.
+		for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+		{
+			if(myColorArray[i] != NULL) UpdateColorArray(i);
+		}
+		myVizMng->RequestRender();
+		return;
+	}
+
+	if(change == DataSet::FieldRangeChanged) BakeLookupTable(field);
+
+	// Color arrays that have not been requested yet will be built on first use.
+	if(myColorArray[field] != NULL)
+	{
+		UpdateLookupIndex(field);
+		UpdateColorArray(field);
+		myVizMng->RequestRender();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::UpdateColorArray(int index)
+{
+	// Gather colors from the baked lookup table, one packed RGBA value per row.
+	const unsigned int* lut = myLookupTable[index];
+	const unsigned short* lutIndex = myLookupIndex[index];
+	unsigned int* colors = (unsigned int*)myColorArray[index]->GetPointer(0);
+	int n = myColorArray[index]->GetNumberOfTuples();
+
+	DataSet* data = myVizMng->GetDataSet();
+	if(data->GetNumBrushedRows() > 0)
+	{
+		// Rows inside all the enabled brushes are drawn with the brush color.
+		const unsigned char* mask = data->GetMaskBuffer();
+		unsigned int brushColor;
+		memcpy(&brushColor, BRUSH_COLOR, sizeof(brushColor));
+		for(int i = 0; i < n; i++)
+		{
+			colors[i] = (mask[i] & DataSet::MaskBrushed) ? brushColor : lut[lutIndex[i]];
+		}
+	}
+	else
+	{
+		for(int i = 0; i < n; i++)
+		{
+			colors[i] = lut[lutIndex[i]];
+		}
+	}
+	myColorArray[index]->Modified();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::OnColorTransferPointChange(int pt)
+{
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		if(myWidget[i] == sender())
+		{
+			QColor color = QColorDialog::getColor();
+			myModel[i]->setPointColor(pt, color);
+			UpdateColorFunction(i);
+			break;
+		}
+	}
+	GetVisualizationManager()->RequestRender();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ColorFunctionManager::OnColorTransferPointMove(int pt)
+{
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		if(myWidget[i] == sender())
+		{
+			UpdateColorFunction(i);
+			break;
+		}
+	}
+	GetVisualizationManager()->RequestRender();
+}
@@ -1,29 +1,29 @@
-/********************************************************************************************************************** 
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *---------------------------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com							http://febretpository.hopto.org
- *---------------------------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *********************************************************************************************************************/ 
-#ifndef CONSOLE_H__
-#define CONSOLE_H__
-
-
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class Console
-{
-public:
-	static void Message(const QString& msg);
-	static void Warning(const QString& msg);
-	static void Error(const QString& msg);
-
-private:
-	Console() {}
-};
-
+/********************************************************************************************************************** 
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *---------------------------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com							http://febretpository.hopto.org
+ *---------------------------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *********************************************************************************************************************/ 
+#ifndef CONSOLE_H__
+#define CONSOLE_H__
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class Console
+{
+public:
+	static void Message(const QString& msg);
+	static void Warning(const QString& msg);
+	static void Error(const QString& msg);
+
+private:
+	Console() {}
+};
+
 #endif
\ No newline at end of file
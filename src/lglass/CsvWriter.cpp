@@ -0,0 +1,319 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "CsvWriter.h"
+#include "DataSetInfo.h"
+
+#include <QFile>
+#include <QFuture>
+#include <QThread>
+#include <QVector>
+#include <QtConcurrentRun>
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Exact powers of ten representable as doubles.
+static const double POW10[] = 
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns value * 10^exponent. Negative exponents divide by exact powers of ten, to keep the result 
+// correctly rounded over the float range.
+static inline double ScalePow10(double value, int exponent)
+{
+	while(exponent > 22) { value *= 1e22; exponent -= 22; }
+	while(exponent < -22) { value /= 1e22; exponent += 22; }
+	return exponent >= 0 ? value * POW10[exponent] : value / POW10[-exponent];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int CsvWriter::Write(DataSet* data, DataSet::SubsetType subset, const QString& fileName)
+{
+	QFile file(fileName);
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return -1;
+
+	DataSetInfo* info = data->GetInfo();
+
+	// Write headers.
+	QVector<int> fields;
+	QByteArray header;
+	header += info->GetTag1Label().c_str();
+	header += ",";
+	header += info->GetTag2Label().c_str();
+	header += ",";
+	header += info->GetTag3Label().c_str();
+	header += ",";
+	header += info->GetTag4Label().c_str();
+	header += ",Timestamp";
+	for(int j = 0; j < info->GetNumFields(); j++)
+	{
+		if(info->GetField(j)->IsEnabled())
+		{
+			header += ",";
+			header += info->GetField(j)->GetLabel().toUtf8();
+			fields.append(j);
+		}
+	}
+	header += "\n";
+	file.write(header);
+
+	// Write data. A window of chunks is kept in flight, so the chunks following the one being written
+	// are formatted meanwhile.
+	int length = data->GetDataLength(subset);
+	int numChunks = (length + ROWS_PER_CHUNK - 1) / ROWS_PER_CHUNK;
+	int window = qMin(qMax(1, QThread::idealThreadCount()) * 2, numChunks);
+
+	QVector<Task> tasks(window);
+	QVector<QByteArray> buffers(window);
+	QVector< QFuture<int> > futures(window);
+	int launched = 0;
+	for(int i = 0; i < numChunks; i++)
+	{
+		while(launched < numChunks && launched < i + window)
+		{
+			int slot = launched % window;
+			Task& task = tasks[slot];
+			task.Data = data;
+			task.Subset = subset;
+			task.Start = launched * ROWS_PER_CHUNK;
+			task.End = qMin(task.Start + ROWS_PER_CHUNK, length);
+			task.Fields = fields.constData();
+			task.NumFields = fields.size();
+			task.Buffer = &buffers[slot];
+			futures[slot] = QtConcurrent::run(&CsvWriter::FormatTask, &task);
+			launched++;
+		}
+
+		int slot = i % window;
+		futures[slot].waitForFinished();
+		file.write(buffers[slot]);
+	}
+
+	file.close();
+	return file.error() == QFile::NoError ? length : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int CsvWriter::FormatTask(Task* task)
+{
+	const int maxRowSize = 4 * (2 * TAG_LEN + 3) + 24 + task->NumFields * (FLOAT_BUFFER_SIZE + 1) + 1;
+
+	QByteArray& buffer = *task->Buffer;
+	if(buffer.size() < maxRowSize) buffer.resize(maxRowSize * 64);
+
+	int size = 0;
+	for(int i = task->Start; i < task->End; i++)
+	{
+		if(buffer.size() - size < maxRowSize) buffer.resize(buffer.size() * 2);
+
+		DataItem* item = task->Data->GetData(i, task->Subset);
+		char* start = buffer.data() + size;
+		char* out = start;
+
+		out += FormatTag(item->Tag1, out);
+		*out++ = ',';
+		out += FormatTag(item->Tag2, out);
+		*out++ = ',';
+		out += FormatTag(item->Tag3, out);
+		*out++ = ',';
+		out += FormatTag(item->Tag4, out);
+		*out++ = ',';
+		out += FormatInteger(item->Timestamp, out);
+		for(int j = 0; j < task->NumFields; j++)
+		{
+			*out++ = ',';
+			out += FormatFloat(item->Field[task->Fields[j]], out);
+		}
+		*out++ = '\n';
+
+		size += out - start;
+	}
+	buffer.resize(size);
+
+	return task->End - task->Start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int CsvWriter::FormatFloat(float value, char* buffer)
+{
+	char* out = buffer;
+	if(value != value)
+	{
+		memcpy(out, "nan", 3);
+		return 3;
+	}
+	if(value < 0) *out++ = '-';
+	double d = fabs((double)value);
+	if(d == 0)
+	{
+		*out++ = '0';
+		return out - buffer;
+	}
+	if(d > FLT_MAX)
+	{
+		memcpy(out, "inf", 3);
+		return out - buffer + 3;
+	}
+
+	// Decimal exponent of the leading digit. log10 can be off by one close to powers of ten.
+	int exponent = (int)floor(log10(d));
+	double lead = ScalePow10(d, -exponent);
+	if(lead >= 10.0) exponent++;
+	else if(lead < 1.0) exponent--;
+
+	// Find the shortest digit count that rounds back to the same float. 9 significant digits
+	// always do for single precision values.
+	qint64 mantissa = 0;
+	int digits = 1;
+	int digitsExponent = exponent;
+	for(; digits <= 9; digits++)
+	{
+		mantissa = (qint64)floor(ScalePow10(d, digits - 1 - exponent) + 0.5);
+		digitsExponent = exponent;
+		if(mantissa >= (qint64)POW10[digits])
+		{
+			// Rounding carried into a new leading digit (e.g. 9.96 -> 10.0).
+			mantissa /= 10;
+			digitsExponent++;
+		}
+		if((float)ScalePow10((double)mantissa, digitsExponent - digits + 1) == (float)d) break;
+	}
+	if(digits > 9) digits = 9;
+
+	char str[10];
+	for(int i = digits - 1; i >= 0; i--)
+	{
+		str[i] = '0' + (char)(mantissa % 10);
+		mantissa /= 10;
+	}
+	int n = digits;
+	while(n > 1 && str[n - 1] == '0') n--;
+
+	if(digitsExponent >= 9 || digitsExponent < -5)
+	{
+		// Scientific notation.
+		*out++ = str[0];
+		if(n > 1)
+		{
+			*out++ = '.';
+			memcpy(out, str + 1, n - 1);
+			out += n - 1;
+		}
+		*out++ = 'e';
+		out += FormatInteger(digitsExponent, out);
+	}
+	else if(digitsExponent >= 0)
+	{
+		int intDigits = digitsExponent + 1;
+		if(n <= intDigits)
+		{
+			memcpy(out, str, n);
+			out += n;
+			memset(out, '0', intDigits - n);
+			out += intDigits - n;
+		}
+		else
+		{
+			memcpy(out, str, intDigits);
+			out += intDigits;
+			*out++ = '.';
+			memcpy(out, str + intDigits, n - intDigits);
+			out += n - intDigits;
+		}
+	}
+	else
+	{
+		*out++ = '0';
+		*out++ = '.';
+		memset(out, '0', -digitsExponent - 1);
+		out += -digitsExponent - 1;
+		memcpy(out, str, n);
+		out += n;
+	}
+	return out - buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int CsvWriter::FormatInteger(qint64 value, char* buffer)
+{
+	char* out = buffer;
+	quint64 v = (quint64)value;
+	if(value < 0)
+	{
+		*out++ = '-';
+		v = (quint64)(-(value + 1)) + 1;
+	}
+
+	char str[20];
+	int n = 0;
+	do
+	{
+		str[n++] = '0' + (char)(v % 10);
+		v /= 10;
+	} while(v != 0);
+
+	while(n > 0) *out++ = str[--n];
+	return out - buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int CsvWriter::FormatTag(const char* tag, char* buffer)
+{
+	int length = 0;
+	bool quote = false;
+	while(length < TAG_LEN && tag[length] != '\0')
+	{
+		char c = tag[length++];
+		if(c == ',' || c == '"' || c == '\n' || c == '\r') quote = true;
+	}
+
+	if(!quote)
+	{
+		memcpy(buffer, tag, length);
+		return length;
+	}
+
+	// Quote the tag, doubling any embedded quotes.
+	char* out = buffer;
+	*out++ = '"';
+	for(int i = 0; i < length; i++)
+	{
+		if(tag[i] == '"') *out++ = '"';
+		*out++ = tag[i];
+	}
+	*out++ = '"';
+	return out - buffer;
+}
@@ -0,0 +1,75 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef CSVWRITER_H
+#define CSVWRITER_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Writes a dataset subset to a CSV file. Rows are split into chunks formatted in parallel into byte buffers, 
+// which are written to the file in row order as soon as each chunk is done.
+class CsvWriter
+{
+public:
+	// Number of rows formatted by each task.
+	static const int ROWS_PER_CHUNK = 16384;
+	// Size of the float formatting buffer required by FormatFloat.
+	static const int FLOAT_BUFFER_SIZE = 24;
+
+public:
+	// Writes the four tags, the timestamp and the enabled fields of all the rows in the subset.
+	// Returns the number of written rows, or -1 if the file could not be opened.
+	static int Write(DataSet* data, DataSet::SubsetType subset, const QString& fileName);
+
+	// Formats value with the fewest significant digits that parse back to the same float. The output
+	// does not depend on the current locale. Returns the number of written characters.
+	static int FormatFloat(float value, char* buffer);
+
+private:
+	struct Task
+	{
+		DataSet* Data;
+		DataSet::SubsetType Subset;
+		int Start;
+		int End;
+		const int* Fields;
+		int NumFields;
+		QByteArray* Buffer;
+	};
+
+	static int FormatTask(Task* task);
+	static int FormatInteger(qint64 value, char* buffer);
+	static int FormatTag(const char* tag, char* buffer);
+};
+
+#endif
@@ -1,827 +1,1238 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "AppConfig.h"
-#include "RepositoryManager.h"
-#include "DataSet.h"
-#include "DataSetInfo.h"
-#include "ProgressWindow.h"
-#include "Utils.h"
-#include  "VtkDataManager.h"
-#include  "Preferences.h"
-
-#include <QTextStream>
-#include <QDateTime>
-
-extern "C"
-{
-#include "eval/evaldefs.h"
-}
-
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-DataSet::DataSet():
-	myData(NULL),
-	myDataLength(0),
-	myNumSortedGroups(0)
-{
-	// create info object.
-	myInfo = new DataSetInfo();
-
-	// initialize ranges array.
-	for (int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
-    {
-		myFieldRange[i][0] =  FLT_MAX;
-        myFieldRange[i][1] =  FLT_MIN;
-    }
-
-	myTimestampRange[0] =  INT_MAX;
-	myTimestampRange[1] =  0;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-DataSet::~DataSet()
-{
-	delete myInfo;
-
-	if(myData != NULL)
-	{
-		delete myData;
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-QString DataSet::GetFieldName(int index)
-{
-	return myInfo->GetField(index)->GetLabel();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-float* DataSet::GetFieldRange(int index)
-{
-	return myFieldRange[index];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::Initialize()
-{
-	Load();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-DataItem* DataSet::GetData(int index, DataSet::SubsetType subset)
-{
-	if(index >= GetDataLength(subset)) return NULL;
-
-	if(subset == DataSet::AllData) return &myData[index];
-	else if(subset == DataSet::FilteredData) return myFilteredData[index];
-	return mySelectedData[index];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-int DataSet::GetDataLength(DataSet::SubsetType subset)
-{
-	if(subset == DataSet::AllData) return myDataLength;
-	else if(subset == DataSet::FilteredData) return myFilteredDataLength;
-	return mySelectedDataLength;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::Load()
-{
-    SetInitMessage("Initializing Sonde Data...");
-
-	// Setup dataset info.
-	myInfo->Load(AppConfig::GetInstance());
-
-	// Load data files.
-	// NOTE: Right now this supports just a single data file, beacuse of a bunch of bugs still lying around.
-	if(myInfo->GetNumFiles() > 1)
-	{
-		Console::Error("This version of Looking Glass does not support multiple CSV file loading. Please specify a single cvs file in the profile configuration.");
-		ShutdownApp(true);
-	}
-
-	int i = 0;
-	while(!myInfo->GetFile(i).isNull())
-	{
-		LoadFile(myInfo->GetFile(i));
-		i++;
-	}
-
-	// Initialize data grouping structures.
-	InitGroups();
-
-	Console::Message(QString("Tag1 Count: %1").arg(myTag1List.count()));
-	Console::Message(QString("Tag2 Count: %1").arg(myTag2List.count()));
-	Console::Message(QString("Tag3 Count: %1").arg(myTag3List.count()));
-	Console::Message(QString("Tag4 Count: %1").arg(myTag4List.count()));
-
-	/*Console::Message("Tag1 Values: " + myTag1List.join(", "));
-	Console::Message("Tag2 Values: " + myTag2List.join(", "));
-	Console::Message("Tag3 Values: " + myTag3List.join(", "));*/
-
-	// Compute field expressions
-	int j = 0;
-	while(myInfo->GetField(j))
-	{
-		UpdateField(j);
-		j++;
-	}
-    SetInitMessage("Done.");
-
-	int zFieldId = myInfo->GetFieldIndex(myInfo->GetZFieldName());
-	int yFieldId = myInfo->GetFieldIndex(myInfo->GetYFieldName());
-	int xFieldId = myInfo->GetFieldIndex(myInfo->GetXFieldName());
-
-	// Initialize X, Y and Z fields.
-	for(int i = 0; i < myDataLength; i++)
-	{
-		myData[i].X = myData[i].Field[xFieldId];
-		myData[i].Y = myData[i].Field[yFieldId];
-		myData[i].Z = myData[i].Field[zFieldId];
-	}
-
-	VtkDataManager::GetInstance()->Update(DataSet::AllData);
-	ApplyFilters();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::UpdateField(int index)
-{
-	FieldInfo* fi = myInfo->GetField(index);
-
-	ProgressWindow* pw = ProgressWindow::GetInstance();
-
-	pw->SetItemName(QString("Computing field: %1").arg(fi->GetLabel()));
-	pw->SetItemProgress(0);
-
-	// Reset ranges.
-	myFieldRange[index][0] =  FLT_MAX;
-    myFieldRange[index][1] =  FLT_MIN;
-
-	if(fi->GetType() == FieldInfo::Expression)
-	{
-		for(int i = 0; i < myDataLength; i++)
-		{
-			Utils::SetEvalVariables(myData[i], myInfo);
-			QString expr = QString("_r = %1").arg(fi->GetExpression());
-			float value = Utils::Eval(expr);
-			myData[i].Field[index] = value;
-
-			// Update field ranges.
-			if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
-			if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
-
-			if(i % 100 == 0) pw->SetItemProgress(i * 100 / myDataLength);
-		}
-	}
-	else if(fi->GetType() == FieldInfo::Script)
-	{
-		FILE* fl = fopen(fi->GetScript().ascii(), "r");
-		if(fl == NULL)
-		{
-			Console::Message(QString("DataSet::UpdateField: cannot open script %1").arg(fi->GetScript()));
-		}
-		else
-		{
-			QTextStream* scriptStream = new QTextStream(fl, QIODevice::ReadOnly);
-			QString script = scriptStream->readAll();
-
-			script = script.replace("#out", "_r");
-			QStringList scriptLines = script.split('\n');
-
-			for(int i = 0; i < myDataLength; i++)
-			{
-				Utils::SetEvalVariables(myData[i], myInfo);
-				float value = 0;
-				
-				QListIterator<QString> li(scriptLines);
-				while(li.hasNext())
-				{
-					value = Utils::Eval(li.next());
-				}
-
-				myData[i].Field[index] = value;
-
-				// Update field ranges.
-				if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
-				if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
-
-				if(i % 100 == 0) pw->SetItemProgress(i * 100 / myDataLength);
-			}
-			fclose(fl);
-			delete scriptStream;
-		}
-	}
-	else
-	{
-		for(int i = 0; i < myDataLength; i++)
-		{
-			float value = myData[i].Field[index];
-			// Update field ranges.
-			if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
-			if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
-		}
-	}
-
-	ProgressWindow::GetInstance()->Done();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::LoadFile(const QString& name)
-{
-#ifdef _DEBUG
-	int dataFilter = DEBUG_DATA_DECIMATION;
-#else
-	int dataFilter = 1;
-#endif
-
-	//QString name = AppConfig::GetInstance()->GetProfileName() + "/" + filename;
-	Console::Message("Loading data file: " + name);
-
-	ProgressWindow* pw = ProgressWindow::GetInstance();
-
-	pw->SetItemName(QString("Loading: %1").arg(name));
-	pw->SetItemProgress(0);
-
-	myDataLength = (Utils::CountFileLines(name) - 1) / dataFilter;
-
-	// Allocate data.
-	myData = new DataItem[myDataLength];
-
-	myFilteredData = new DataItem*[myDataLength];
-	myFilteredDataLength = 0;
-
-	mySelectedData = new DataItem*[myDataLength];
-	mySelectedDataLength = 0;
-
-	QFile* file = RepositoryManager::GetInstance()->TryOpen(name);
-	QTextStream dataFile(file);
-
-	QString line = dataFile.readLine();
-	line = dataFile.readLine();
-	int curIdx = 0;
-	int k = 0;
-	while(!line.isNull())
-	{
-		if((k % dataFilter) == 0)
-		{
-			QStringList tokens = line.split(',');
-
-			// Parse date, time.
-			int tid = myInfo->GetTimestampTimeIndex();
-			int did = myInfo->GetTimestampDateIndex();
-
-			CheckTokenIndex(tokens, tid, k, "TimestampTimeIndex");
-			CheckTokenIndex(tokens, did, k, "TimestampDateIndex");
-
-			QString dtString = tokens[did] + " " + tokens[tid];
-			QDateTime dtm = QDateTime::fromString(dtString, myInfo->GetTimestampStringFormat());
-
-			int m = dtm.date().month();
-			int d = dtm.date().day();
-			int y = dtm.date().year();
-
-			if(!dtm.isValid())
-			{
-				Console::Warning(QString("Invalid date and time at line %1: %2").arg(k + 2).arg(dtString));
-			}
-			else
-			{
-				myData[curIdx].Timestamp = dtm.toTime_t();
-				if(myData[curIdx].Timestamp < myTimestampRange[0]) myTimestampRange[0] = myData[curIdx].Timestamp;
-				if(myData[curIdx].Timestamp > myTimestampRange[1]) myTimestampRange[1] = myData[curIdx].Timestamp;
-			}
-
-			// Read tags if present in specification
-			if(myInfo->GetTag1Index() != -1)
-			{
-				CheckTokenIndex(tokens, myInfo->GetTag1Index(), k, "Tag1Index");
-				strcpy(myData[curIdx].Tag1, tokens[myInfo->GetTag1Index()].ascii());
-
-				if(!myTag1List.contains(myData[curIdx].Tag1)) myTag1List.insert(myData[curIdx].Tag1, 1);
-				//else myTag1List[myData[curIdx].Tag1] = myTag1List[myData[curIdx].Tag1] = 1;
-			}
-			if(myInfo->GetTag2Index() != -1)
-			{
-				CheckTokenIndex(tokens, myInfo->GetTag2Index(), k, "Tag2Index");
-				strcpy(myData[curIdx].Tag2, tokens[myInfo->GetTag2Index()].ascii());
-
-				if(!myTag2List.contains(myData[curIdx].Tag2)) myTag2List.insert(myData[curIdx].Tag2, 1);
-				//else myTag2List[myData[curIdx].Tag2] = myTag1List[myData[curIdx].Tag2] = 1;
-			}
-			if(myInfo->GetTag3Index() != -1)
-			{
-				CheckTokenIndex(tokens, myInfo->GetTag3Index(), k, "Tag3Index");
-				strcpy(myData[curIdx].Tag3, tokens[myInfo->GetTag3Index()].ascii());
-
-				if(!myTag3List.contains(myData[curIdx].Tag3)) myTag3List.insert(myData[curIdx].Tag3, 1);
-				//else myTag3List[myData[curIdx].Tag3] = myTag3List[myData[curIdx].Tag3] = 1;
-			}
-			if(myInfo->GetTag4Index() != -1)
-			{
-				CheckTokenIndex(tokens, myInfo->GetTag4Index(), k, "Tag4Index");
-				strcpy(myData[curIdx].Tag4, tokens[myInfo->GetTag4Index()].ascii());
-
-				if(!myTag4List.contains(myData[curIdx].Tag4)) myTag4List.insert(myData[curIdx].Tag4, 1);
-				//else myTag3List[myData[curIdx].Tag3] = myTag3List[myData[curIdx].Tag3] = 1;
-			}
-
-			for(int i = 0; myInfo->GetField(i) != NULL; i++)
-			{
-				FieldInfo* fi = myInfo->GetField(i);
-				if(fi->GetType() == FieldInfo::Data)
-				{
-					// Parse and store the field value.
-					int fid = fi->GetFieldIndex();
-					CheckTokenIndex(tokens, fid, k, fi->GetName());
-					float value = tokens[fid].toFloat();
-					myData[curIdx].Field[i] = value;
-				}
-			}
-			curIdx++;
-		}
-		line = dataFile.readLine();
-		k++;
-		if(k % 100 == 0) pw->SetItemProgress(k * 100 / (myDataLength * dataFilter));
-	}
-
-	myDataLength = curIdx;
-
-	pw->Done();
-
-	file->close();
-	delete file;
-	file = NULL;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-//void DataSet::InitSondeBathyData()
-//{
-//	mySondeBathyVtkData = vtkUnstructuredGrid::New();
-//
-//	vtkPoints* pts = vtkPoints::New();
-//	
-//	int curPt = 0;
-//	int curX = myData[0].X;
-//	int curY = myData[0].Y;
-//	for(int i = 0; i < myDataLength; i++)
-//	{
-//		if(myData[i].Y != curY || myData[i].X != curX)
-//		{
-//			curX =  myData[i].X;
-//			curY =  myData[i].Y;
-//			curPt++;
-//		}
-//	}
-//	pts->SetNumberOfPoints(curPt);
-//
-//	mySondeBathyVtkData->SetPoints(pts);
-//
-//	vtkFloatArray* fields; 
-//	fields = vtkFloatArray::New();
-//	fields->Allocate(curPt);
-//
-//	fields->SetName("Z");
-//	mySondeBathyVtkData->GetPointData()->AddArray(fields);
-//
-//	curX = myData[0].X;
-//	curY = myData[0].Y;
-//	float maxZ = 0;
-//	curPt = 0;
-//	for(int i = 0; i < myDataLength; i++)
-//	{
-//		if(myData[i].Y == curY && myData[i].X == curX)
-//		{
-//			if(maxZ < myData[i].Z)
-//			{
-//				maxZ = myData[i].Z;
-//			}
-//		}
-//		else
-//		{
-//			// Insert a new point (x and y coordinates have to be switched...
-//			// TODO: fix transforms to avoid this and keep things more consistent).
-//			pts->SetPoint(curPt, curY, maxZ - mySondeBathyDepthCorrection, curX);
-//			// Add field values.
-//			fields->InsertValue(curPt, maxZ - mySondeBathyDepthCorrection);
-//			//printf("Added point: %f\n", maxZ - mySondeBathyDepthCorrection);
-//			maxZ = 0;
-//			curX =  myData[i].X;
-//			curY =  myData[i].Y;
-//			curPt++;
-//		}
-//	}
-//
-//	fields->Delete();
-//	pts->Delete();
-//
-//	//double* range = myVtkData->GetBounds();
-//	//printf("Sonde Range: %f-%f %f-%f %f-%f\n", range[0], range[1], range[2], range[3], range[4], range[5]);
-//}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-float* DataSet::GetZRange()
-{
-	int zFieldId = myInfo->GetFieldIndex(myInfo->GetZFieldName());
-	return myFieldRange[zFieldId];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-float* DataSet::GetYRange()
-{
-	int yFieldId = myInfo->GetFieldIndex(myInfo->GetYFieldName());
-	return myFieldRange[yFieldId];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-float* DataSet::GetXRange()
-{
-	int xFieldId = myInfo->GetFieldIndex(myInfo->GetXFieldName());
-	return myFieldRange[xFieldId];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::SaveAsCSV(const QString& fileName)
-{
-	FILE* file = fopen(fileName, "w");
-	QTextStream out(file);
-
-	QString data;
-
-	// Write headers
-	data += QString::fromStdString(myInfo->GetTag1Label());
-	data += ",";
-
-	for(int j = 0; j < myInfo->GetNumFields(); j++)
-	{
-		if(myInfo->GetField(j)->IsEnabled())
-		{
-			data += myInfo->GetField(j)->GetLabel() + ",";
-		}
-	}
-
-	data += "\n";
-	out << data;
-
-	// Write data.
-	SubsetType sst = DataSet::FilteredData;
-	if(GetDataLength(DataSet::SelectedData) > 0) sst = DataSet::SelectedData;
-
-	for(int i = 0; i < GetDataLength(sst); i++)
-	{
-		data = "";
-		DataItem* item = GetData(i, sst);
-
-		data += item->Tag1;
-		data += ",";
-
-		for(int j = 0; j < myInfo->GetNumFields(); j++)
-		{
-			if(myInfo->GetField(j)->IsEnabled())
-			{
-				data += QString("%1").arg(item->Field[j]) + ",";
-			}
-		}
-		data += "\n";
-		out << data;
-	}
-
-	out.flush();
-	fclose(file);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::AddFilter(DynamicFilter* filter)
-{
-	myFilters.push_back(filter);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::RemoveFilter(DynamicFilter* filter)
-{
-	myFilters.remove(filter);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::ApplyFilters()
-{
-	// Do we need this?
-	//UpdateFilteredDataLength();
-
-	myFilteredDataLength = 0;
-
-	// Clean up the filtered data array
-	memset(myFilteredData, 0, sizeof(DataItem*) * myDataLength);
-
-	int c = 0;
-	for(int i = 0; i < myDataLength; i++)
-	{
-		if(ItemFilterPass(i))
-		{
-			myFilteredData[c] = &myData[i];
-			c++;
-		}
-	}
-
-	myFilteredDataLength = c;
-
-	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
-	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
-
-	VtkDataManager::GetInstance()->Update(DataSet::FilteredData);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-bool DataSet::ItemFilterPass(int index)
-{
-	for(int i = 0; i < myFilters.length(); i++)
-	{
-		DynamicFilter* f = myFilters[i];
-		if(f->Enabled)
-		{
-			if(f->Type == DynamicFilter::FieldFilter)
-			{
-				float value = myData[index].Field[f->FieldId];
-				if(value < f->Min || value > f->Max) return false;
-			}
-			else if(f->Type == DynamicFilter::TimeFilter)
-			{
-				time_t value = myData[index].Timestamp;
-				if(value < f->TimeMin || value > f->TimeMax) return false;
-			}
-			else
-			{
-				Utils::SetEvalVariables(myData[index], myInfo);
-				QString expr = QString("_r = %1").arg(f->Expression);
-				float result = Utils::Eval(expr);
-				if (result == 0) return false;
-			}
-		}
-	}
-	return true;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::CheckTokenIndex(const QStringList& tokens, int index, int line, const QString& fieldName)
-{
-	if(index < 0 || index >= tokens.length())
-	{
-		Console::Error(QString("Invalid field index while loading dataset - Field name: %1 index: %2 data line: %3").arg(fieldName).arg(index).arg(line));
-		ShutdownApp(true, false);
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-DataItem* DataSet::FindDataItem(float x, float y, float z)
-{
-	for(int i = 0; i < myFilteredDataLength; i++)
-	{
-		if(myFilteredData[i]->X == x &&
-			myFilteredData[i]->Y == y &&
-			myFilteredData[i]->Z == z) return myFilteredData[i];
-	}
-	return NULL;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-QPair<float, float> DataSet::ComputeGroupRange(int fieldId, DynamicFilter::FilterGrouping grouping, const QString& tag)
-{
-	if(grouping == DynamicFilter::Global) 
-	{
-		return QPair<float, float>(myFieldRange[fieldId][0], myFieldRange[fieldId][1]);
-	}
-	float min = FLT_MAX;
-	float max = FLT_MIN;
-	for(int i = 0; i < myDataLength; i++)
-	{
-		if(myData[i].Tag1 == tag)
-		{
-			float value = myData[i].Field[fieldId];
-			if(value < min) min = value;
-			if(value > max) max = value;
-		}
-	}
-	return QPair<float, float>(min, max);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-int DataSet::CountTagGroups(DataSetInfo::TagId tagId)
-{
-	if(tagId == DataSetInfo::Tag1) return myTag1List.count();
-	if(tagId == DataSetInfo::Tag2) return myTag2List.count();
-	if(tagId == DataSetInfo::Tag3) return myTag3List.count();
-	else return myTag4List.count();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-QString DataSet::GetTag(DataSetInfo::TagId tagId, int index)
-{
-	if(tagId == DataSetInfo::Tag1) return myTag1List.keys()[index];
-	else if(tagId == DataSetInfo::Tag2) return myTag2List.keys()[index];
-	else if(tagId == DataSetInfo::Tag3) return myTag3List.keys()[index];
-	else return myTag4List.keys()[index];
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::SelectByTag(QString tag, DataSetInfo::TagId tagId, SubsetType subset, SelectMode mode)
-{
-	int i = 0;
-	DataItem* item = NULL;
-	while(true)
-	{
-		// Get next item.
-		item = GetData(i, subset);
-		if(!item) break;
-
-		// Get tag
-		QString itag = item->GetTag(tagId);
-
-		if(itag == tag)
-		{
-			if(mode == DataSet::SelectionAdd || mode == DataSet::SelectionNew) 
-			{
-				item->Flags |= DataItem::Selected;
-			}
-			else if(mode == DataSet::SelectionToggle)
-			{
-				if((item->Flags & DataItem::Selected) == DataItem::Selected)
-				{
-					item->Flags &= ~DataItem::Selected;
-				}
-				else
-				{
-					item->Flags |= DataItem::Selected;
-				}
-			}
-			item->FlagsChanged = true;
-		}
-		else if(mode == DataSet::SelectionNew)
-		{
-			item->Flags &= ~DataItem::Selected;
-			item->FlagsChanged = true;
-		}
-		else
-		{
-			item->FlagsChanged = false;
-		}
-
-		i++;
-	}
-
-	mySelectedDataLength = UpdateSubset(mySelectedData, DataItem::Selected);
-
-	VtkDataManager::GetInstance()->Update(DataSet::SelectedData);
-
-	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
-	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::ClearSelection()
-{
-	DataItem* item = NULL;
-	int i = 0;
-	while(true)
-	{
-		// Get next item.
-		item = GetData(i, DataSet::AllData);
-		if(!item) break;
-		item->Flags &= ~DataItem::Selected;
-		i++;
-	}
-
-	mySelectedDataLength = UpdateSubset(mySelectedData, DataItem::Selected);
-
-	VtkDataManager::GetInstance()->Update(DataSet::SelectedData);
-
-	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
-	myNumSortedGroups = 0;
-	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::InitGroups()
-{
-	for(int i = 0; i < MAX_GROUPS; i++)
-	{
-		myGroups[i].Items = new DataItem*[myDataLength];
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-DataGroup* DataSet::FindGroup(const QString& tag)
-{
-	for(int i = 0; i < myNumGroups; i++)
-	{
-		if(myGroups[i].Tag == tag) return &myGroups[i];
-	}
-	return NULL;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void DataSet::UpdateGroups(DataSetInfo::TagId tagId, SubsetType subset)
-{
-	myNumGroups = CountTagGroups(tagId);
-	if(myNumGroups > MAX_GROUPS)
-	{
-		Console::Error(QString("DataSet::UpdateGroups Too may groups! required: %1, supported: %2").arg(myNumGroups).arg(MAX_GROUPS));
-		ShutdownApp(true, true);
-	}
-
-	// Create groups
-	for(int i = 0; i < myNumGroups; i++)
-	{
-		myGroups[i].Size = 0;
-		myGroups[i].Tag = GetTag(tagId, i);
-	}
-
-    int i = 0;
-	bool done = false;
-	DataItem* item = NULL;
-	while(true)
-	{
-		// Get next item.
-		item = GetData(i, subset);
-		if(!item) break;
-
-		// Get tag
-		QString tag = item->GetTag(tagId);
-
-		// Get data group
-		DataGroup* grp = FindGroup(tag);
-		if(!grp)
-		{
-			Console::Error("DataSet::UpdateGroups: Invalid group tag: " + tag);
-			ShutdownApp(true);
-		}
-
-		if(item->FlagsChanged)
-		{
-			// This is a newly selected item.
-			item->FlagsChanged = false;
-			if(myNumSortedGroups == 0 || mySortedGroups[myNumSortedGroups - 1] != grp)
-			{
-				mySortedGroups[myNumSortedGroups] = grp;
-				myNumSortedGroups++;
-			}
-		}
-
-		// Insert element.
-		grp->Items[grp->Size] = item;
-		grp->Size++;
-
-		i++;
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-int DataSet::UpdateSubset(DataItem** subset, DataItem::ItemFlags flag)
-{
-	int size = 0;
-	int i = 0;
-	DataItem* item = NULL;
-	while(true)
-	{
-		// Get next item.
-		item = GetData(i, DataSet::AllData);
-		if(!item) break;
-
-		if((item->Flags & flag) == flag)
-		{
-			subset[size] = item;
-			size++;
-		}
-		i++;
-	}
-	return size;
-}
-
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "AppConfig.h"
+#include "BinaryDataFile.h"
+#include "CsvWriter.h"
+#include "RepositoryManager.h"
+#include "DataSet.h"
+#include "DataSetInfo.h"
+#include "ProgressWindow.h"
+#include "TimePyramid.h"
+#include "Utils.h"
+#include  "VtkDataManager.h"
+#include  "Preferences.h"
+
+#include <QTextStream>
+#include <QDateTime>
+#include <QtAlgorithms>
+
+extern "C"
+{
+#include "eval/evaldefs.h"
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+DataSet::DataSet():
+	myNumBrushedRows(0),
+	myTimeOrderValid(false),
+	myData(NULL),
+	myDataLength(0),
+	myNumSortedGroups(0),
+	myPositionBuffer(NULL),
+	myMask(NULL)
+{
+	// create info object.
+	myInfo = new DataSetInfo();
+
+	// initialize ranges array.
+	for (int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+    {
+		myFieldRange[i][0] =  FLT_MAX;
+        myFieldRange[i][1] =  FLT_MIN;
+		myFieldColumn[i] = NULL;
+		myTimePyramid[i] = NULL;
+    }
+
+	myTimestampRange[0] =  INT_MAX;
+	myTimestampRange[1] =  0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+DataSet::~DataSet()
+{
+	delete myInfo;
+
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		delete[] myFieldColumn[i];
+		delete myTimePyramid[i];
+	}
+	delete[] myPositionBuffer;
+	delete[] myMask;
+
+	if(myData != NULL)
+	{
+		delete myData;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+QString DataSet::GetFieldName(int index)
+{
+	return myInfo->GetField(index)->GetLabel();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+float* DataSet::GetFieldRange(int index)
+{
+	return myFieldRange[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SetFieldEnabled(int index, bool enabled)
+{
+	FieldInfo* field = myInfo->GetField(index);
+	if(field->IsEnabled() == enabled) return;
+	field->SetEnabled(enabled);
+	NotifyChange(FieldsEnabledChanged, index);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::Initialize()
+{
+	Load();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+DataItem* DataSet::GetData(int index, DataSet::SubsetType subset)
+{
+	if(index >= GetDataLength(subset)) return NULL;
+
+	if(subset == DataSet::AllData) return &myData[index];
+	else if(subset == DataSet::FilteredData) return myFilteredData[index];
+	return mySelectedData[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int DataSet::GetDataLength(DataSet::SubsetType subset)
+{
+	if(subset == DataSet::AllData) return myDataLength;
+	else if(subset == DataSet::FilteredData) return myFilteredDataLength;
+	return mySelectedDataLength;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::Load()
+{
+    SetInitMessage("Initializing Sonde Data...");
+
+	// Setup dataset info.
+	myInfo->Load(AppConfig::GetInstance());
+
+	// Load data files.
+	// NOTE: Right now this supports just a single data file, beacuse of a bunch of bugs still lying around.
+	if(myInfo->GetNumFiles() > 1)
+	{
+		Console::Error("This version of Looking Glass does not support multiple CSV file loading. Please specify a single cvs file in the profile configuration.");
+		ShutdownApp(true);
+	}
+
+	int i = 0;
+	while(!myInfo->GetFile(i).isNull())
+	{
+		LoadFile(myInfo->GetFile(i));
+		i++;
+	}
+
+	// Initialize data grouping structures.
+	InitGroups();
+
+	Console::Message(QString("Tag1 Count: %1").arg(myTag1List.count()));
+	Console::Message(QString("Tag2 Count: %1").arg(myTag2List.count()));
+	Console::Message(QString("Tag3 Count: %1").arg(myTag3List.count()));
+	Console::Message(QString("Tag4 Count: %1").arg(myTag4List.count()));
+
+	/*Console::Message("Tag1 Values: " + myTag1List.join(", "));
+	Console::Message("Tag2 Values: " + myTag2List.join(", "));
+	Console::Message("Tag3 Values: " + myTag3List.join(", "));*/
+
+	// Allocate column storage. Columns are filled by UpdateField.
+	for(int i = 0; i < myInfo->GetNumFields(); i++)
+	{
+		myFieldColumn[i] = new float[myDataLength];
+	}
+	myPositionBuffer = new float[myDataLength * 3];
+
+	// Compute field expressions
+	int j = 0;
+	while(myInfo->GetField(j))
+	{
+		UpdateField(j);
+		j++;
+	}
+    SetInitMessage("Done.");
+
+	int zFieldId = myInfo->GetFieldIndex(myInfo->GetZFieldName());
+	int yFieldId = myInfo->GetFieldIndex(myInfo->GetYFieldName());
+	int xFieldId = myInfo->GetFieldIndex(myInfo->GetXFieldName());
+
+	// Initialize X, Y and Z fields.
+	for(int i = 0; i < myDataLength; i++)
+	{
+		myData[i].X = myData[i].Field[xFieldId];
+		myData[i].Y = myData[i].Field[yFieldId];
+		myData[i].Z = myData[i].Field[zFieldId];
+
+		myPositionBuffer[i * 3] = myData[i].Y;
+		myPositionBuffer[i * 3 + 1] = myData[i].Z;
+		myPositionBuffer[i * 3 + 2] = myData[i].X;
+	}
+
+	VtkDataManager::GetInstance()->Update(DataSet::AllData);
+	ApplyFilters();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::UpdateField(int index)
+{
+	FieldInfo* fi = myInfo->GetField(index);
+
+	ProgressWindow* pw = ProgressWindow::GetInstance();
+
+	pw->SetItemName(QString("Computing field: %1").arg(fi->GetLabel()));
+	pw->SetItemProgress(0);
+
+	float oldRange[2] = { myFieldRange[index][0], myFieldRange[index][1] };
+
+	// Reset ranges.
+	myFieldRange[index][0] =  FLT_MAX;
+    myFieldRange[index][1] =  FLT_MIN;
+
+	if(fi->GetType() == FieldInfo::Expression)
+	{
+		for(int i = 0; i < myDataLength; i++)
+		{
+			Utils::SetEvalVariables(myData[i], myInfo);
+			QString expr = QString("_r = %1").arg(fi->GetExpression());
+			float value = Utils::Eval(expr);
+			myData[i].Field[index] = value;
+
+			// Update field ranges.
+			if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
+			if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
+
+			if(i % 100 == 0) pw->SetItemProgress(i * 100 / myDataLength);
+		}
+	}
+	else if(fi->GetType() == FieldInfo::Script)
+	{
+		FILE* fl = fopen(fi->GetScript().ascii(), "r");
+		if(fl == NULL)
+		{
+			Console::Message(QString("DataSet::UpdateField: cannot open script %1").arg(fi->GetScript()));
+		}
+		else
+		{
+			QTextStream* scriptStream = new QTextStream(fl, QIODevice::ReadOnly);
+			QString script = scriptStream->readAll();
+
+			script = script.replace("#out", "_r");
+			QStringList scriptLines = script.split('\n');
+
+			for(int i = 0; i < myDataLength; i++)
+			{
+				Utils::SetEvalVariables(myData[i], myInfo);
+				float value = 0;
+				
+				QListIterator<QString> li(scriptLines);
+				while(li.hasNext())
+				{
+					value = Utils::Eval(li.next());
+				}
+
+				myData[i].Field[index] = value;
+
+				// Update field ranges.
+				if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
+				if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
+
+				if(i % 100 == 0) pw->SetItemProgress(i * 100 / myDataLength);
+			}
+			fclose(fl);
+			delete scriptStream;
+		}
+	}
+	else
+	{
+		for(int i = 0; i < myDataLength; i++)
+		{
+			float value = myData[i].Field[index];
+			// Update field ranges.
+			if(value < myFieldRange[index][0]) myFieldRange[index][0] = value;
+			if(value > myFieldRange[index][1]) myFieldRange[index][1] = value;
+		}
+	}
+
+	// Update column storage.
+	float* column = myFieldColumn[index];
+	if(column != NULL)
+	{
+		for(int i = 0; i < myDataLength; i++)
+		{
+			column[i] = myData[i].Field[index];
+		}
+	}
+	InvalidateTimeSeries(index);
+
+	ProgressWindow::GetInstance()->Done();
+
+	NotifyChange(FieldValuesChanged, index);
+	if(oldRange[0] != myFieldRange[index][0] || oldRange[1] != myFieldRange[index][1])
+	{
+		NotifyChange(FieldRangeChanged, index);
+	}
+
+	// Reevaluate the brushes using this field.
+	bool brushesChanged = false;
+	for(int i = 0; i < myBrushes.size(); i++)
+	{
+		DataBrush* brush = myBrushes[i];
+		if(brush->Enabled && (brush->XFieldId == index || brush->YFieldId == index))
+		{
+			EvaluateBrush(brush);
+			brushesChanged = true;
+		}
+	}
+	if(brushesChanged)
+	{
+		CombineBrushes();
+		NotifyChange(BrushChanged);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::LoadFile(const QString& name)
+{
+	if(BinaryDataFile::IsBinaryFile(name))
+	{
+		LoadBinaryFile(name);
+		return;
+	}
+
+#ifdef _DEBUG
+	int dataFilter = DEBUG_DATA_DECIMATION;
+#else
+	int dataFilter = 1;
+#endif
+
+	//QString name = AppConfig::GetInstance()->GetProfileName() + "/" + filename;
+	Console::Message("Loading data file: " + name);
+
+	ProgressWindow* pw = ProgressWindow::GetInstance();
+
+	pw->SetItemName(QString("Loading: %1").arg(name));
+	pw->SetItemProgress(0);
+
+	AllocateData((Utils::CountFileLines(name) - 1) / dataFilter);
+
+	QFile* file = RepositoryManager::GetInstance()->TryOpen(name);
+	QTextStream dataFile(file);
+
+	QString line = dataFile.readLine();
+	line = dataFile.readLine();
+	int curIdx = 0;
+	int k = 0;
+	while(!line.isNull())
+	{
+		if((k % dataFilter) == 0)
+		{
+			QStringList tokens = line.split(',');
+
+			// Parse date, time.
+			int tid = myInfo->GetTimestampTimeIndex();
+			int did = myInfo->GetTimestampDateIndex();
+
+			CheckTokenIndex(tokens, tid, k, "TimestampTimeIndex");
+			CheckTokenIndex(tokens, did, k, "TimestampDateIndex");
+
+			QString dtString = tokens[did] + " " + tokens[tid];
+			QDateTime dtm = QDateTime::fromString(dtString, myInfo->GetTimestampStringFormat());
+
+			int m = dtm.date().month();
+			int d = dtm.date().day();
+			int y = dtm.date().year();
+
+			if(!dtm.isValid())
+			{
+				Console::Warning(QString("Invalid date and time at line %1: %2").arg(k + 2).arg(dtString));
+			}
+			else
+			{
+				myData[curIdx].Timestamp = dtm.toTime_t();
+				if(myData[curIdx].Timestamp < myTimestampRange[0]) myTimestampRange[0] = myData[curIdx].Timestamp;
+				if(myData[curIdx].Timestamp > myTimestampRange[1]) myTimestampRange[1] = myData[curIdx].Timestamp;
+			}
+
+			// Read tags if present in specification
+			if(myInfo->GetTag1Index() != -1)
+			{
+				CheckTokenIndex(tokens, myInfo->GetTag1Index(), k, "Tag1Index");
+				strcpy(myData[curIdx].Tag1, tokens[myInfo->GetTag1Index()].ascii());
+
+				if(!myTag1List.contains(myData[curIdx].Tag1)) myTag1List.insert(myData[curIdx].Tag1, 1);
+				//else myTag1List[myData[curIdx].Tag1] = myTag1List[myData[curIdx].Tag1] = 1;
+			}
+			if(myInfo->GetTag2Index() != -1)
+			{
+				CheckTokenIndex(tokens, myInfo->GetTag2Index(), k, "Tag2Index");
+				strcpy(myData[curIdx].Tag2, tokens[myInfo->GetTag2Index()].ascii());
+
+				if(!myTag2List.contains(myData[curIdx].Tag2)) myTag2List.insert(myData[curIdx].Tag2, 1);
+				//else myTag2List[myData[curIdx].Tag2] = myTag1List[myData[curIdx].Tag2] = 1;
+			}
+			if(myInfo->GetTag3Index() != -1)
+			{
+				CheckTokenIndex(tokens, myInfo->GetTag3Index(), k, "Tag3Index");
+				strcpy(myData[curIdx].Tag3, tokens[myInfo->GetTag3Index()].ascii());
+
+				if(!myTag3List.contains(myData[curIdx].Tag3)) myTag3List.insert(myData[curIdx].Tag3, 1);
+				//else myTag3List[myData[curIdx].Tag3] = myTag3List[myData[curIdx].Tag3] = 1;
+			}
+			if(myInfo->GetTag4Index() != -1)
+			{
+				CheckTokenIndex(tokens, myInfo->GetTag4Index(), k, "Tag4Index");
+				strcpy(myData[curIdx].Tag4, tokens[myInfo->GetTag4Index()].ascii());
+
+				if(!myTag4List.contains(myData[curIdx].Tag4)) myTag4List.insert(myData[curIdx].Tag4, 1);
+				//else myTag3List[myData[curIdx].Tag3] = myTag3List[myData[curIdx].Tag3] = 1;
+			}
+
+			for(int i = 0; myInfo->GetField(i) != NULL; i++)
+			{
+				FieldInfo* fi = myInfo->GetField(i);
+				if(fi->GetType() == FieldInfo::Data)
+				{
+					// Parse and store the field value.
+					int fid = fi->GetFieldIndex();
+					CheckTokenIndex(tokens, fid, k, fi->GetName());
+					float value = tokens[fid].toFloat();
+					myData[curIdx].Field[i] = value;
+				}
+			}
+			curIdx++;
+		}
+		line = dataFile.readLine();
+		k++;
+		if(k % 100 == 0) pw->SetItemProgress(k * 100 / (myDataLength * dataFilter));
+	}
+
+	myDataLength = curIdx;
+
+	pw->Done();
+
+	file->close();
+	delete file;
+	file = NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::LoadBinaryFile(const QString& name)
+{
+	Console::Message("Loading binary data file: " + name);
+
+	ProgressWindow* pw = ProgressWindow::GetInstance();
+
+	pw->SetItemName(QString("Loading: %1").arg(name));
+	pw->SetItemProgress(0);
+
+	QFile* file = RepositoryManager::GetInstance()->TryOpen(name);
+	BinaryDataFile bin;
+	if(!bin.Open(file))
+	{
+		Console::Error("Invalid binary data file: " + name);
+		AllocateData(0);
+	}
+	else
+	{
+		AllocateData(bin.GetNumRows());
+
+		// Timestamps.
+		const qint64* timestamps = bin.GetTimestamps();
+		for(int i = 0; i < myDataLength; i++)
+		{
+			myData[i].Timestamp = timestamps[i];
+		}
+		if(myDataLength > 0)
+		{
+			myTimestampRange[0] = bin.GetTimestampRange()[0];
+			myTimestampRange[1] = bin.GetTimestampRange()[1];
+		}
+
+		// Tags. Entries are copied from the file dictionaries, the per row indices select the entry.
+		QHash<QString, int>* tagLists[BinaryDataFile::NUM_TAGS] = { &myTag1List, &myTag2List, &myTag3List, &myTag4List };
+		int tagLength = qMin(bin.GetTagLength(), TAG_LEN - 1);
+		for(int t = 0; t < BinaryDataFile::NUM_TAGS; t++)
+		{
+			QVector<QByteArray> entries(bin.GetTagDictionarySize(t));
+			for(int e = 0; e < entries.size(); e++)
+			{
+				const char* entry = bin.GetTagEntry(t, e);
+				entries[e] = QByteArray(entry, qstrnlen(entry, tagLength));
+				tagLists[t]->insert(entries[e], 1);
+			}
+
+			const quint32* indices = bin.GetTagIndices(t);
+			for(int i = 0; i < myDataLength; i++)
+			{
+				const QByteArray& entry = entries[indices[i]];
+				char* tag = myData[i].GetTag((DataSetInfo::TagId)t);
+				memcpy(tag, entry.constData(), entry.size() + 1);
+			}
+		}
+		pw->SetItemProgress(50);
+
+		// Data fields are matched to the file columns by name.
+		for(int j = 0; myInfo->GetField(j) != NULL; j++)
+		{
+			FieldInfo* fi = myInfo->GetField(j);
+			if(fi->GetType() == FieldInfo::Data)
+			{
+				int column = bin.FindField(fi->GetName());
+				if(column == -1)
+				{
+					Console::Warning(QString("Field %1 not found in %2").arg(fi->GetName()).arg(name));
+				}
+				const float* values = column != -1 ? bin.GetFieldColumn(column) : NULL;
+				for(int i = 0; i < myDataLength; i++)
+				{
+					myData[i].Field[j] = values != NULL ? values[i] : 0;
+				}
+			}
+		}
+		bin.Close();
+	}
+
+	pw->Done();
+
+	file->close();
+	delete file;
+	file = NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::AllocateData(int length)
+{
+	myDataLength = length;
+
+	myData = new DataItem[myDataLength];
+
+	myFilteredData = new DataItem*[myDataLength];
+	myFilteredDataLength = 0;
+
+	mySelectedData = new DataItem*[myDataLength];
+	mySelectedDataLength = 0;
+
+	myMask = new unsigned char[myDataLength];
+	memset(myMask, 0, myDataLength);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//void DataSet::InitSondeBathyData()
+//{
+//	mySondeBathyVtkData = vtkUnstructuredGrid::New();
+//
+//	vtkPoints* pts = vtkPoints::New();
+//	
+//	int curPt = 0;
+//	int curX = myData[0].X;
+//	int curY = myData[0].Y;
+//	for(int i = 0; i < myDataLength; i++)
+//	{
+//		if(myData[i].Y != curY || myData[i].X != curX)
+//		{
+//			curX =  myData[i].X;
+//			curY =  myData[i].Y;
+//			curPt++;
+//		}
+//	}
+//	pts->SetNumberOfPoints(curPt);
+//
+//	mySondeBathyVtkData->SetPoints(pts);
+//
+//	vtkFloatArray* fields; 
+//	fields = vtkFloatArray::New();
+//	fields->Allocate(curPt);
+//
+//	fields->SetName("Z");
+//	mySondeBathyVtkData->GetPointData()->AddArray(fields);
+//
+//	curX = myData[0].X;
+//	curY = myData[0].Y;
+//	float maxZ = 0;
+//	curPt = 0;
+//	for(int i = 0; i < myDataLength; i++)
+//	{
+//		if(myData[i].Y == curY && myData[i].X == curX)
+//		{
+//			if(maxZ < myData[i].Z)
+//			{
+//				maxZ = myData[i].Z;
+//			}
+//		}
+//		else
+//		{
+//			// Insert a new point (x and y coordinates have to be switched...
+//			// TODO: fix transforms to avoid this and keep things more consistent).
+//			pts->SetPoint(curPt, curY, maxZ - mySondeBathyDepthCorrection, curX);
+//			// Add field values.
+//			fields->InsertValue(curPt, maxZ - mySondeBathyDepthCorrection);
+//			//printf("Added point: %f\n", maxZ - mySondeBathyDepthCorrection);
+//			maxZ = 0;
+//			curX =  myData[i].X;
+//			curY =  myData[i].Y;
+//			curPt++;
+//		}
+//	}
+//
+//	fields->Delete();
+//	pts->Delete();
+//
+//	//double* range = myVtkData->GetBounds();
+//	//printf("Sonde Range: %f-%f %f-%f %f-%f\n", range[0], range[1], range[2], range[3], range[4], range[5]);
+//}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+float* DataSet::GetZRange()
+{
+	int zFieldId = myInfo->GetFieldIndex(myInfo->GetZFieldName());
+	return myFieldRange[zFieldId];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+float* DataSet::GetYRange()
+{
+	int yFieldId = myInfo->GetFieldIndex(myInfo->GetYFieldName());
+	return myFieldRange[yFieldId];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+float* DataSet::GetXRange()
+{
+	int xFieldId = myInfo->GetFieldIndex(myInfo->GetXFieldName());
+	return myFieldRange[xFieldId];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SaveAsCSV(const QString& fileName)
+{
+	// Export the selection if there is one, otherwise the filtered data.
+	SubsetType sst = DataSet::FilteredData;
+	if(GetDataLength(DataSet::SelectedData) > 0) sst = DataSet::SelectedData;
+	SaveAsCSV(fileName, sst);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SaveAsCSV(const QString& fileName, SubsetType subset)
+{
+	QTime timer;
+	timer.start();
+
+	int rows = CsvWriter::Write(this, subset, fileName);
+	if(rows < 0)
+	{
+		Console::Error("Could not write " + fileName);
+		return;
+	}
+	Console::Message(QString("Saved %1 rows to %2 in %3 ms").arg(rows).arg(fileName).arg(timer.elapsed()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SaveAsBinary(const QString& fileName)
+{
+	SubsetType sst = DataSet::FilteredData;
+	if(GetDataLength(DataSet::SelectedData) > 0) sst = DataSet::SelectedData;
+	SaveAsBinary(fileName, sst);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SaveAsBinary(const QString& fileName, SubsetType subset)
+{
+	QTime timer;
+	timer.start();
+
+	int rows = BinaryDataFile::Write(this, subset, fileName);
+	if(rows < 0)
+	{
+		Console::Error("Could not write " + fileName);
+		return;
+	}
+	Console::Message(QString("Saved %1 rows to %2 in %3 ms").arg(rows).arg(fileName).arg(timer.elapsed()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::AddFilter(DynamicFilter* filter)
+{
+	myFilters.push_back(filter);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::RemoveFilter(DynamicFilter* filter)
+{
+	myFilters.removeAll(filter);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::AddBrush(DataBrush* brush)
+{
+	myBrushes.push_back(brush);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::RemoveBrush(DataBrush* brush)
+{
+	myBrushes.removeAll(brush);
+	if(brush->Enabled)
+	{
+		CombineBrushes();
+		NotifyChange(BrushChanged);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::UpdateBrush(DataBrush* brush)
+{
+	if(brush->Enabled) EvaluateBrush(brush);
+	CombineBrushes();
+	NotifyChange(BrushChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::EvaluateBrush(DataBrush* brush)
+{
+	const float* x = myFieldColumn[brush->XFieldId];
+	const float* y = myFieldColumn[brush->YFieldId];
+	brush->Pass.resize(myDataLength);
+	for(int i = 0; i < myDataLength; i++)
+	{
+		brush->Pass.setBit(i, 
+			x[i] >= brush->XMin && x[i] <= brush->XMax && 
+			y[i] >= brush->YMin && y[i] <= brush->YMax);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::CombineBrushes()
+{
+	// Intersect the cached bitmaps of the enabled brushes. The data itself is not visited.
+	QBitArray brushed;
+	bool active = false;
+	for(int i = 0; i < myBrushes.size(); i++)
+	{
+		DataBrush* brush = myBrushes[i];
+		if(brush->Enabled && brush->Pass.size() == myDataLength)
+		{
+			if(active) brushed &= brush->Pass;
+			else brushed = brush->Pass;
+			active = true;
+		}
+	}
+
+	myNumBrushedRows = active ? brushed.count(true) : 0;
+	for(int i = 0; i < myDataLength; i++)
+	{
+		if(active && brushed.testBit(i)) myMask[i] |= MaskBrushed;
+		else myMask[i] &= ~MaskBrushed;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::ApplyFilters()
+{
+	// Do we need this?
+	//UpdateFilteredDataLength();
+
+	myFilteredDataLength = 0;
+
+	// Clean up the filtered data array
+	memset(myFilteredData, 0, sizeof(DataItem*) * myDataLength);
+
+	// Field and time filters are evaluated one column at a time. Expression filters need the whole row, so they
+	// are only evaluated on the rows passing all the other filters.
+	QVector<char> pass(myDataLength, 1);
+	char* p = pass.data();
+	bool expressionFilters = false;
+	for(int j = 0; j < myFilters.length(); j++)
+	{
+		DynamicFilter* f = myFilters[j];
+		if(!f->Enabled) continue;
+		if(f->Type == DynamicFilter::FieldFilter)
+		{
+			const float* column = myFieldColumn[f->FieldId];
+			float fmin = f->Min;
+			float fmax = f->Max;
+			for(int i = 0; i < myDataLength; i++)
+			{
+				p[i] &= !(column[i] < fmin || column[i] > fmax);
+			}
+		}
+		else if(f->Type == DynamicFilter::TimeFilter)
+		{
+			for(int i = 0; i < myDataLength; i++)
+			{
+				time_t value = myData[i].Timestamp;
+				p[i] &= !(value < f->TimeMin || value > f->TimeMax);
+			}
+		}
+		else
+		{
+			expressionFilters = true;
+		}
+	}
+
+	int c = 0;
+	for(int i = 0; i < myDataLength; i++)
+	{
+		if(p[i] && (!expressionFilters || ItemExpressionFilterPass(i)))
+		{
+			myFilteredData[c] = &myData[i];
+			myMask[i] |= MaskFiltered;
+			c++;
+		}
+		else
+		{
+			myMask[i] &= ~MaskFiltered;
+		}
+	}
+
+	myFilteredDataLength = c;
+
+	InvalidateTimeSeries();
+
+	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
+	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
+
+	VtkDataManager::GetInstance()->Update(DataSet::FilteredData);
+
+	NotifyChange(FilteredChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Orders row ids by timestamp.
+struct TimestampLess
+{
+	TimestampLess(const DataItem* data): Data(data) {}
+	bool operator()(int a, int b) const { return Data[a].Timestamp < Data[b].Timestamp; }
+	const DataItem* Data;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::UpdateTimeOrder()
+{
+	myTimeOrder.resize(myFilteredDataLength);
+	bool sorted = true;
+	for(int i = 0; i < myFilteredDataLength; i++)
+	{
+		myTimeOrder[i] = GetRowId(myFilteredData[i]);
+		if(i > 0 && myFilteredData[i]->Timestamp < myFilteredData[i - 1]->Timestamp) sorted = false;
+	}
+	// Data files are usually already sorted by time.
+	if(!sorted) qStableSort(myTimeOrder.begin(), myTimeOrder.end(), TimestampLess(myData));
+
+	mySortedTimestamps.resize(myFilteredDataLength);
+	for(int i = 0; i < myFilteredDataLength; i++)
+	{
+		mySortedTimestamps[i] = myData[myTimeOrder[i]].Timestamp;
+	}
+	myTimeOrderValid = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const QVector<int>& DataSet::GetTimeOrder()
+{
+	if(!myTimeOrderValid) UpdateTimeOrder();
+	return myTimeOrder;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const QVector<time_t>& DataSet::GetSortedTimestamps()
+{
+	if(!myTimeOrderValid) UpdateTimeOrder();
+	return mySortedTimestamps;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TimePyramid* DataSet::GetTimePyramid(int field)
+{
+	if(myTimePyramid[field] == NULL)
+	{
+		const QVector<int>& order = GetTimeOrder();
+		const float* column = myFieldColumn[field];
+		QVector<float> values(order.size());
+		for(int i = 0; i < order.size(); i++)
+		{
+			values[i] = column[order[i]];
+		}
+		myTimePyramid[field] = new TimePyramid();
+		myTimePyramid[field]->Build(mySortedTimestamps.constData(), values.constData(), values.size());
+	}
+	return myTimePyramid[field];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::InvalidateTimeSeries(int field)
+{
+	if(field == -1) myTimeOrderValid = false;
+	for(int i = 0; i < DataSetInfo::MAX_FIELDS; i++)
+	{
+		if(field == -1 || field == i)
+		{
+			delete myTimePyramid[i];
+			myTimePyramid[i] = NULL;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool DataSet::ItemExpressionFilterPass(int index)
+{
+	for(int i = 0; i < myFilters.length(); i++)
+	{
+		DynamicFilter* f = myFilters[i];
+		if(f->Enabled && f->Type != DynamicFilter::FieldFilter && f->Type != DynamicFilter::TimeFilter)
+		{
+			Utils::SetEvalVariables(myData[index], myInfo);
+			QString expr = QString("_r = %1").arg(f->Expression);
+			float result = Utils::Eval(expr);
+			if (result == 0) return false;
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::CheckTokenIndex(const QStringList& tokens, int index, int line, const QString& fieldName)
+{
+	if(index < 0 || index >= tokens.length())
+	{
+		Console::Error(QString("Invalid field index while loading dataset - Field name: %1 index: %2 data line: %3").arg(fieldName).arg(index).arg(line));
+		ShutdownApp(true, false);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+QPair<float, float> DataSet::ComputeGroupRange(int fieldId, DynamicFilter::FilterGrouping grouping, const QString& tag)
+{
+	if(grouping == DynamicFilter::Global) 
+	{
+		return QPair<float, float>(myFieldRange[fieldId][0], myFieldRange[fieldId][1]);
+	}
+	float min = FLT_MAX;
+	float max = FLT_MIN;
+	for(int i = 0; i < myDataLength; i++)
+	{
+		if(myData[i].Tag1 == tag)
+		{
+			float value = myData[i].Field[fieldId];
+			if(value < min) min = value;
+			if(value > max) max = value;
+		}
+	}
+	return QPair<float, float>(min, max);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int DataSet::CountTagGroups(DataSetInfo::TagId tagId)
+{
+	if(tagId == DataSetInfo::Tag1) return myTag1List.count();
+	if(tagId == DataSetInfo::Tag2) return myTag2List.count();
+	if(tagId == DataSetInfo::Tag3) return myTag3List.count();
+	else return myTag4List.count();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+QString DataSet::GetTag(DataSetInfo::TagId tagId, int index)
+{
+	if(tagId == DataSetInfo::Tag1) return myTag1List.keys()[index];
+	else if(tagId == DataSetInfo::Tag2) return myTag2List.keys()[index];
+	else if(tagId == DataSetInfo::Tag3) return myTag3List.keys()[index];
+	else return myTag4List.keys()[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SelectByTag(QString tag, DataSetInfo::TagId tagId, SubsetType subset, SelectMode mode)
+{
+	int i = 0;
+	DataItem* item = NULL;
+	while(true)
+	{
+		// Get next item.
+		item = GetData(i, subset);
+		if(!item) break;
+
+		// Get tag
+		QString itag = item->GetTag(tagId);
+
+		if(itag == tag)
+		{
+			if(mode == DataSet::SelectionAdd || mode == DataSet::SelectionNew) 
+			{
+				item->Flags |= DataItem::Selected;
+			}
+			else if(mode == DataSet::SelectionToggle)
+			{
+				if((item->Flags & DataItem::Selected) == DataItem::Selected)
+				{
+					item->Flags &= ~DataItem::Selected;
+				}
+				else
+				{
+					item->Flags |= DataItem::Selected;
+				}
+			}
+			item->FlagsChanged = true;
+		}
+		else if(mode == DataSet::SelectionNew)
+		{
+			item->Flags &= ~DataItem::Selected;
+			item->FlagsChanged = true;
+		}
+		else
+		{
+			item->FlagsChanged = false;
+		}
+
+		i++;
+	}
+
+	mySelectedDataLength = UpdateSubset(mySelectedData, DataItem::Selected);
+
+	VtkDataManager::GetInstance()->Update(DataSet::SelectedData);
+
+	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
+	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
+
+	NotifyChange(SelectionChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::SelectByRowIds(const QVector<int>& rowIds, SelectMode mode)
+{
+	for(int i = 0; i < myDataLength; i++)
+	{
+		DataItem* item = &myData[i];
+		if(mode == DataSet::SelectionNew && (item->Flags & DataItem::Selected) == DataItem::Selected)
+		{
+			item->Flags &= ~DataItem::Selected;
+			item->FlagsChanged = true;
+		}
+		else
+		{
+			item->FlagsChanged = false;
+		}
+	}
+
+	for(int i = 0; i < rowIds.size(); i++)
+	{
+		int rowId = rowIds[i];
+		if(rowId < 0 || rowId >= myDataLength) continue;
+
+		DataItem* item = &myData[rowId];
+		if(mode == DataSet::SelectionToggle && (item->Flags & DataItem::Selected) == DataItem::Selected)
+		{
+			item->Flags &= ~DataItem::Selected;
+		}
+		else
+		{
+			item->Flags |= DataItem::Selected;
+		}
+		item->FlagsChanged = true;
+	}
+
+	mySelectedDataLength = UpdateSubset(mySelectedData, DataItem::Selected);
+
+	VtkDataManager::GetInstance()->Update(DataSet::SelectedData);
+
+	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
+	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
+
+	NotifyChange(SelectionChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::ClearSelection()
+{
+	DataItem* item = NULL;
+	int i = 0;
+	while(true)
+	{
+		// Get next item.
+		item = GetData(i, DataSet::AllData);
+		if(!item) break;
+		item->Flags &= ~DataItem::Selected;
+		i++;
+	}
+
+	mySelectedDataLength = UpdateSubset(mySelectedData, DataItem::Selected);
+
+	VtkDataManager::GetInstance()->Update(DataSet::SelectedData);
+
+	Preferences* pref = AppConfig::GetInstance()->GetPreferences();
+	myNumSortedGroups = 0;
+	UpdateGroups(pref->GetGroupingTagId(), pref->GetGroupingSubset());
+
+	NotifyChange(SelectionChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::InitGroups()
+{
+	for(int i = 0; i < MAX_GROUPS; i++)
+	{
+		myGroups[i].Items = new DataItem*[myDataLength];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+DataGroup* DataSet::FindGroup(const QString& tag)
+{
+	for(int i = 0; i < myNumGroups; i++)
+	{
+		if(myGroups[i].Tag == tag) return &myGroups[i];
+	}
+	return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::UpdateGroups(DataSetInfo::TagId tagId, SubsetType subset)
+{
+	myNumGroups = CountTagGroups(tagId);
+	if(myNumGroups > MAX_GROUPS)
+	{
+		Console::Error(QString("DataSet::UpdateGroups Too may groups! required: %1, supported: %2").arg(myNumGroups).arg(MAX_GROUPS));
+		ShutdownApp(true, true);
+	}
+
+	// Create groups
+	for(int i = 0; i < myNumGroups; i++)
+	{
+		myGroups[i].Size = 0;
+		myGroups[i].Tag = GetTag(tagId, i);
+	}
+
+    int i = 0;
+	bool done = false;
+	DataItem* item = NULL;
+	while(true)
+	{
+		// Get next item.
+		item = GetData(i, subset);
+		if(!item) break;
+
+		// Get tag
+		QString tag = item->GetTag(tagId);
+
+		// Get data group
+		DataGroup* grp = FindGroup(tag);
+		if(!grp)
+		{
+			Console::Error("DataSet::UpdateGroups: Invalid group tag: " + tag);
+			ShutdownApp(true);
+		}
+
+		if(item->FlagsChanged)
+		{
+			// This is a newly selected item.
+			item->FlagsChanged = false;
+			if(myNumSortedGroups == 0 || mySortedGroups[myNumSortedGroups - 1] != grp)
+			{
+				mySortedGroups[myNumSortedGroups] = grp;
+				myNumSortedGroups++;
+			}
+		}
+
+		// Insert element.
+		grp->Items[grp->Size] = item;
+		grp->Size++;
+
+		i++;
+	}
+
+	NotifyChange(GroupingChanged);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int DataSet::UpdateSubset(DataItem** subset, DataItem::ItemFlags flag)
+{
+	unsigned char maskBit = (flag == DataItem::Selected) ? MaskSelected : MaskFiltered;
+	int size = 0;
+	int i = 0;
+	DataItem* item = NULL;
+	while(true)
+	{
+		// Get next item.
+		item = GetData(i, DataSet::AllData);
+		if(!item) break;
+
+		if((item->Flags & flag) == flag)
+		{
+			subset[size] = item;
+			myMask[i] |= maskBit;
+			size++;
+		}
+		else
+		{
+			myMask[i] &= ~maskBit;
+		}
+		i++;
+	}
+	return size;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::AddListener(DataSetListener* listener, int changeMask)
+{
+	ListenerEntry entry;
+	entry.Listener = listener;
+	entry.ChangeMask = changeMask;
+	myListeners.append(entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::RemoveListener(DataSetListener* listener)
+{
+	for(int i = myListeners.size() - 1; i >= 0; i--)
+	{
+		if(myListeners[i].Listener == listener) myListeners.removeAt(i);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DataSet::NotifyChange(ChangeType change, int field)
+{
+	for(int i = 0; i < myListeners.size(); i++)
+	{
+		if((myListeners[i].ChangeMask & change) != 0)
+		{
+			myListeners[i].Listener->OnDataSetChanged(change, field);
+		}
+	}
+}
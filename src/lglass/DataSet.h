@@ -1,250 +1,367 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#ifndef DATASET_H
-#define DATASET_H
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#include "LookingGlassSystem.h"
-#include "DataSetInfo.h"
-
-#include <QHash>
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Length of tag text.
-#define TAG_LEN 32
-
-// Maximum number of data groups.
-#define MAX_GROUPS 1024
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Represents a single dataset item. 
-struct DataItem
-{
-	enum ItemFlags 
-	{
-		None = 0,
-		Filtered = 1,
-		Selected = 1 << 2
-	};
-
-	// Constructor: set default values for some of the fields.
-	DataItem()
-	{
-		Flags = None;
-		FlagsChanged = false;
-		Timestamp = 0;
-	}
-
-	char* GetTag(DataSetInfo::TagId id)
-	{
-		if(id == DataSetInfo::Tag1) return Tag1;
-		else if(id == DataSetInfo::Tag2) return Tag2;
-		else if(id == DataSetInfo::Tag3) return Tag3;
-		return Tag4;
-	}
-
-	float X;
-	float Y;
-	float Z;
-	time_t Timestamp;
-	float Field[DataSetInfo::MAX_FIELDS];
-	char Tag1[TAG_LEN];
-	char Tag2[TAG_LEN];
-	char Tag3[TAG_LEN];
-	char Tag4[TAG_LEN];
-	unsigned int Flags; 
-	bool FlagsChanged;
-};
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Represents a data group. 
-struct DataGroup
-{
-	int Size;
-	QString Tag;
-	DataItem** Items;
-};
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-struct DynamicFilter
-{
-	enum FilterType 
-	{ 
-		ExpressionFilter = 1 << 1, 
-		RangeCutoffFilter = 1 << 2,
-		TimeFilter = 1 << 3,
-		FieldFilter = 1 << 4 
-	};
-
-	// Grouping is used for filters that compute aggregate values (i.e. min, max values) to decide wether the
-	// aggregation is global on the dataset or on subsets of the data identified by a tag.
-	enum FilterGrouping
-	{
-		Global,
-		Tag1
-	};
-
-	bool Enabled;
-	FilterType Type;
-	FilterGrouping Grouping;
-	QString Expression;
-	int FieldId;
-	float Min;
-	float Max;
-	time_t TimeMin;
-	time_t TimeMax;
-};
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class DataSet
-{
-public:
-	// Data subset.
-	// TODO: use this and unify methods to access data length and data.
-	enum SubsetType { AllData, FilteredData, SelectedData };
-	enum SelectMode { SelectionNew, SelectionAdd, SelectionToggle };
-
-public:
-	static const int SLICE_SEPARATION = 128; 
-
-public:
-	// Ctor / Dtor.
-	DataSet();
-	~DataSet();
-
-	// Other methods.
-	void Initialize();
-
-	// Tag data access.
-	int CountTagGroups(DataSetInfo::TagId tagId);
-	QString GetTag(DataSetInfo::TagId tagId, int index);
-
-	// Field information
-	QString GetFieldName(int index);
-	float* GetFieldRange(int index);
-
-	// Filter management
-	void AddFilter(DynamicFilter* filter);
-	void RemoveFilter(DynamicFilter* filter);
-	void ApplyFilters();
-
-	// Data selection
-	void SelectByTag(QString tag, DataSetInfo::TagId tagId, SubsetType subset, SelectMode mode);
-	void ClearSelection();
-
-	// Convenience methods for retrieving the range of X, Y, and Z fields.
-	float* GetZRange();
-	float* GetYRange();
-	float* GetXRange();
-	time_t* GetTimestampRange() { return myTimestampRange; }
-	
-	// Access grouped ranges.
-	QPair<float, float> ComputeGroupRange(int fieldId, DynamicFilter::FilterGrouping grouping, const QString& tag = QString());
-
-	// Field update
-	void UpdateField(int index);
-	bool FilterPass(int index, int dataIdx);
-
-	// Data item access.
-	DataItem* FindDataItem(float x, float y, float z);
-
-	// Access data.
-	DataItem* GetData(int index, DataSet::SubsetType subset);
-	int GetDataLength(DataSet::SubsetType subset);
-
-	// Gets or Sets the depth correction used for sonde-based bathymetry model generation.
-	void SetSondeBathyDepthCorrection(float value);
-	float GetSondeBathyDepthCorrection();
-
-	// Groups
-	int GetNumGroups() { return myNumGroups; }
-	int GetNumSortedGroups() { return myNumSortedGroups; }
-	DataGroup* GetGroup(int index) { return &myGroups[index]; } 
-	DataGroup* GetSortedGroup(int index) { return mySortedGroups[index]; } 
-	DataGroup* FindGroup(const QString& tag);
-	void UpdateGroups(DataSetInfo::TagId tagId, SubsetType subset);
-
-	// Dataset info.
-	DataSetInfo* GetInfo() { return myInfo; }
-
-	// Save dataset.
-	void SaveAsCSV(const QString& fileName);
-
-public:
-	//static const int InvalidValue = -999;
-
-private:
-	//enum LoadStep { Invalid, SondeData };
-
-private:
-	void Load();
-	void LoadFile(const QString& name);
-	bool ItemFilterPass(int index);
-	void InitGroups();
-	void CheckTokenIndex(const QStringList& tokens, int index, int line, const QString& fieldName);
-
-	int UpdateSubset(DataItem** subset, DataItem::ItemFlags flag);
-
-private:
-	// DatatSet info object.
-	DataSetInfo* myInfo;
-
-	QList<DynamicFilter*> myFilters;
-
-	// Data ranges.
-	time_t myTimestampRange[2];
-	float myFieldRange[DataSetInfo::MAX_FIELDS][2];
-
-	// Data.
-	DataItem* myData;
-	int myDataLength;
-
-	// Filtered Data.
-	DataItem** myFilteredData;
-	int myFilteredDataLength;
-
-	// Selected Data.
-	DataItem** mySelectedData;
-	int mySelectedDataLength;
-
-	// Tag lists.
-	QHash<QString, int> myTag1List;
-	QHash<QString, int> myTag2List;
-	QHash<QString, int> myTag3List;
-	QHash<QString, int> myTag4List;
-
-	// Data Groups
-	int myNumGroups;
-	DataGroup myGroups[MAX_GROUPS];
-	int myNumSortedGroups;
-	DataGroup* mySortedGroups[MAX_GROUPS];
-};
-#endif 
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef DATASET_H
+#define DATASET_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSetInfo.h"
+
+#include <QBitArray>
+#include <QHash>
+#include <QVector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Length of tag text.
+#define TAG_LEN 32
+
+// Maximum number of data groups.
+#define MAX_GROUPS 1024
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Represents a single dataset item. 
+struct DataItem
+{
+	enum ItemFlags 
+	{
+		None = 0,
+		Filtered = 1,
+		Selected = 1 << 2
+	};
+
+	// Constructor: set default values for some of the fields.
+	DataItem()
+	{
+		Flags = None;
+		FlagsChanged = false;
+		Timestamp = 0;
+	}
+
+	char* GetTag(DataSetInfo::TagId id)
+	{
+		if(id == DataSetInfo::Tag1) return Tag1;
+		else if(id == DataSetInfo::Tag2) return Tag2;
+		else if(id == DataSetInfo::Tag3) return Tag3;
+		return Tag4;
+	}
+
+	float X;
+	float Y;
+	float Z;
+	time_t Timestamp;
+	float Field[DataSetInfo::MAX_FIELDS];
+	char Tag1[TAG_LEN];
+	char Tag2[TAG_LEN];
+	char Tag3[TAG_LEN];
+	char Tag4[TAG_LEN];
+	unsigned int Flags; 
+	bool FlagsChanged;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Represents a data group. 
+struct DataGroup
+{
+	int Size;
+	QString Tag;
+	DataItem** Items;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct DynamicFilter
+{
+	enum FilterType 
+	{ 
+		ExpressionFilter = 1 << 1, 
+		RangeCutoffFilter = 1 << 2,
+		TimeFilter = 1 << 3,
+		FieldFilter = 1 << 4 
+	};
+
+	// Grouping is used for filters that compute aggregate values (i.e. min, max values) to decide wether the
+	// aggregation is global on the dataset or on subsets of the data identified by a tag.
+	enum FilterGrouping
+	{
+		Global,
+		Tag1
+	};
+
+	bool Enabled;
+	FilterType Type;
+	FilterGrouping Grouping;
+	QString Expression;
+	int FieldId;
+	float Min;
+	float Max;
+	time_t TimeMin;
+	time_t TimeMax;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A rectangular brush over two fields. Brushes do not filter the data: the rows inside all the enabled brushes are 
+// marked as brushed in the subset mask, so that views can highlight them.
+struct DataBrush
+{
+	DataBrush(): Enabled(false), XFieldId(0), YFieldId(0), XMin(0), XMax(0), YMin(0), YMax(0) {}
+
+	bool Enabled;
+	int XFieldId;
+	int YFieldId;
+	float XMin;
+	float XMax;
+	float YMin;
+	float YMax;
+	// Cached pass bitmap, with one bit per row of the full dataset. Updated by DataSet::UpdateBrush.
+	QBitArray Pass;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class DataSetListener;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class DataSet
+{
+public:
+	// Data subset.
+	// TODO: use this and unify methods to access data length and data.
+	enum SubsetType { AllData, FilteredData, SelectedData };
+	enum SelectMode { SelectionNew, SelectionAdd, SelectionToggle };
+	// Bits of the per row subset mask.
+	enum MaskBits { MaskFiltered = 1, MaskSelected = 1 << 1, MaskBrushed = 1 << 2 };
+	// Types of change notified to dataset listeners. Values can be combined in a listener change mask.
+	enum ChangeType 
+	{ 
+		FilteredChanged = 1, 
+		SelectionChanged = 1 << 1, 
+		FieldValuesChanged = 1 << 2, 
+		FieldRangeChanged = 1 << 3, 
+		GroupingChanged = 1 << 4,
+		BrushChanged = 1 << 5,
+		FieldsEnabledChanged = 1 << 6
+	};
+
+public:
+	static const int SLICE_SEPARATION = 128; 
+
+public:
+	// Ctor / Dtor.
+	DataSet();
+	~DataSet();
+
+	// Other methods.
+	void Initialize();
+
+	// Tag data access.
+	int CountTagGroups(DataSetInfo::TagId tagId);
+	QString GetTag(DataSetInfo::TagId tagId, int index);
+
+	// Field information
+	QString GetFieldName(int index);
+	float* GetFieldRange(int index);
+	// Enables or disables a field. Listeners are notified with FieldsEnabledChanged if the field state changes.
+	void SetFieldEnabled(int index, bool enabled);
+
+	// Filter management
+	void AddFilter(DynamicFilter* filter);
+	void RemoveFilter(DynamicFilter* filter);
+	void ApplyFilters();
+
+	// Brush management. UpdateBrush must be called after changing a brush: it only reevaluates that brush, then
+	// combines the cached pass bitmaps of all the enabled brushes into the MaskBrushed bits of the subset mask.
+	void AddBrush(DataBrush* brush);
+	void RemoveBrush(DataBrush* brush);
+	void UpdateBrush(DataBrush* brush);
+	// Returns the number of rows inside all the enabled brushes (0 when no brush is enabled).
+	int GetNumBrushedRows() { return myNumBrushedRows; }
+
+	// Data selection
+	void SelectByTag(QString tag, DataSetInfo::TagId tagId, SubsetType subset, SelectMode mode);
+	// Selects items using their row index in the full dataset (see GetRowId).
+	void SelectByRowIds(const QVector<int>& rowIds, SelectMode mode);
+	void ClearSelection();
+
+	// Convenience methods for retrieving the range of X, Y, and Z fields.
+	float* GetZRange();
+	float* GetYRange();
+	float* GetXRange();
+	time_t* GetTimestampRange() { return myTimestampRange; }
+	
+	// Access grouped ranges.
+	QPair<float, float> ComputeGroupRange(int fieldId, DynamicFilter::FilterGrouping grouping, const QString& tag = QString());
+
+	// Field update
+	void UpdateField(int index);
+	bool FilterPass(int index, int dataIdx);
+
+	// Access data.
+	DataItem* GetData(int index, DataSet::SubsetType subset);
+	int GetDataLength(DataSet::SubsetType subset);
+	// Returns the row index of an item in the full dataset.
+	int GetRowId(DataItem* item) { return item - myData; }
+
+	// Column storage access. Each field column is a contiguous array of values for the full dataset,
+	// indexed by row id. The position buffer stores (Y, Z, X) triples, matching the point layout used
+	// by the 3D view. Both are kept in sync with the data items by Load and UpdateField.
+	float* GetFieldColumn(int index) { return myFieldColumn[index]; }
+	float* GetPositionBuffer() { return myPositionBuffer; }
+	// Returns the subset mask: one byte per row, storing a combination of MaskBits values. The mask
+	// is updated every time filters or selection change.
+	unsigned char* GetMaskBuffer() { return myMask; }
+
+	// Time series access. Returns the row ids of the filtered data sorted by timestamp, and the matching
+	// timestamps. Both are built on first use after the filtered data changes.
+	const QVector<int>& GetTimeOrder();
+	const QVector<time_t>& GetSortedTimestamps();
+	// Returns the time pyramid of a field over the filtered data, in GetTimeOrder order. Pyramids are built 
+	// on first use, and rebuilt after the filtered data or the field values change.
+	TimePyramid* GetTimePyramid(int field);
+
+	// Gets or Sets the depth correction used for sonde-based bathymetry model generation.
+	void SetSondeBathyDepthCorrection(float value);
+	float GetSondeBathyDepthCorrection();
+
+	// Groups
+	int GetNumGroups() { return myNumGroups; }
+	int GetNumSortedGroups() { return myNumSortedGroups; }
+	DataGroup* GetGroup(int index) { return &myGroups[index]; } 
+	DataGroup* GetSortedGroup(int index) { return mySortedGroups[index]; } 
+	DataGroup* FindGroup(const QString& tag);
+	void UpdateGroups(DataSetInfo::TagId tagId, SubsetType subset);
+
+	// Dataset info.
+	DataSetInfo* GetInfo() { return myInfo; }
+
+	// Change notification. A listener only receives the changes included in its change mask (a
+	// combination of ChangeType values).
+	void AddListener(DataSetListener* listener, int changeMask);
+	void RemoveListener(DataSetListener* listener);
+
+	// Saves the selected rows, or the filtered rows if nothing is selected.
+	void SaveAsCSV(const QString& fileName);
+	void SaveAsCSV(const QString& fileName, SubsetType subset);
+	// Saves the same subset as SaveAsCSV in the binary columnar format (see BinaryDataFile).
+	void SaveAsBinary(const QString& fileName);
+	void SaveAsBinary(const QString& fileName, SubsetType subset);
+
+public:
+	//static const int InvalidValue = -999;
+
+private:
+	//enum LoadStep { Invalid, SondeData };
+
+private:
+	void Load();
+	// Loads a CSV data file, or a binary data file if the name has the BinaryDataFile extension.
+	void LoadFile(const QString& name);
+	void LoadBinaryFile(const QString& name);
+	void AllocateData(int length);
+	// Evaluates the expression filters on a single row. Field and time filters are evaluated by column in ApplyFilters.
+	bool ItemExpressionFilterPass(int index);
+	void InitGroups();
+	void CheckTokenIndex(const QStringList& tokens, int index, int line, const QString& fieldName);
+
+	int UpdateSubset(DataItem** subset, DataItem::ItemFlags flag);
+	void UpdateTimeOrder();
+	void InvalidateTimeSeries(int field = -1);
+	void NotifyChange(ChangeType change, int field = -1);
+	void EvaluateBrush(DataBrush* brush);
+	void CombineBrushes();
+
+private:
+	struct ListenerEntry
+	{
+		DataSetListener* Listener;
+		int ChangeMask;
+	};
+
+private:
+	// DatatSet info object.
+	DataSetInfo* myInfo;
+
+	QList<DynamicFilter*> myFilters;
+
+	// Brushes.
+	QList<DataBrush*> myBrushes;
+	int myNumBrushedRows;
+
+	// Time series.
+	QVector<int> myTimeOrder;
+	QVector<time_t> mySortedTimestamps;
+	bool myTimeOrderValid;
+	TimePyramid* myTimePyramid[DataSetInfo::MAX_FIELDS];
+
+	// Data ranges.
+	time_t myTimestampRange[2];
+	float myFieldRange[DataSetInfo::MAX_FIELDS][2];
+
+	// Data.
+	DataItem* myData;
+	int myDataLength;
+
+	// Filtered Data.
+	DataItem** myFilteredData;
+	int myFilteredDataLength;
+
+	// Selected Data.
+	DataItem** mySelectedData;
+	int mySelectedDataLength;
+
+	// Tag lists.
+	QHash<QString, int> myTag1List;
+	QHash<QString, int> myTag2List;
+	QHash<QString, int> myTag3List;
+	QHash<QString, int> myTag4List;
+
+	// Data Groups
+	int myNumGroups;
+	DataGroup myGroups[MAX_GROUPS];
+	int myNumSortedGroups;
+	DataGroup* mySortedGroups[MAX_GROUPS];
+
+	// Column storage.
+	float* myFieldColumn[DataSetInfo::MAX_FIELDS];
+	float* myPositionBuffer;
+	unsigned char* myMask;
+
+	QList<ListenerEntry> myListeners;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Interface for objects that need to be notified of dataset changes. See DataSet::AddListener.
+class DataSetListener
+{
+public:
+	virtual ~DataSetListener() {}
+	// Called after the dataset changed. field is the index of the changed field for field changes, 
+	// -1 otherwise.
+	virtual void OnDataSetChanged(DataSet::ChangeType change, int field) = 0;
+};
+#endif 
@@ -0,0 +1,256 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "DensityBinner.h"
+
+#include <QFuture>
+#include <QThread>
+#include <QVector>
+#include <QtConcurrentRun>
+
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::Bin(const float* x, const float* y, int length, 
+	const double xRange[2], const double yRange[2], int width, int height, unsigned int* counts)
+{
+	int numBins = width * height;
+	memset(counts, 0, sizeof(unsigned int) * numBins);
+	if(length <= 0 || numBins <= 0 || xRange[1] <= xRange[0] || yRange[1] <= yRange[0]) return 0;
+
+	int numTasks = qMin(QThread::idealThreadCount(), length / MIN_POINTS_PER_TASK);
+	if(numTasks < 1) numTasks = 1;
+	int chunkSize = (length + numTasks - 1) / numTasks;
+
+	// The first task bins directly into the output histogram, the others into their own buffers.
+	QVector<Task> tasks(numTasks);
+	QVector< QVector<unsigned int> > partialCounts(numTasks - 1);
+	for(int i = 0; i < numTasks; i++)
+	{
+		Task& task = tasks[i];
+		task.X = x;
+		task.Y = y;
+		task.Start = i * chunkSize;
+		task.End = qMin(length, (i + 1) * chunkSize);
+		task.XMin = xRange[0];
+		task.YMin = yRange[0];
+		task.XScale = width / (xRange[1] - xRange[0]);
+		task.YScale = height / (yRange[1] - yRange[0]);
+		task.Width = width;
+		task.Height = height;
+		if(i == 0)
+		{
+			task.Counts = counts;
+		}
+		else
+		{
+			partialCounts[i - 1].fill(0, numBins);
+			task.Counts = partialCounts[i - 1].data();
+		}
+	}
+
+	QList< QFuture<int> > futures;
+	for(int i = 1; i < numTasks; i++)
+	{
+		futures.append(QtConcurrent::run(&DensityBinner::BinTask, &tasks[i]));
+	}
+	int binned = BinTask(&tasks[0]);
+
+	// Reduce the partial histograms.
+	for(int i = 1; i < numTasks; i++)
+	{
+		binned += futures[i - 1].result();
+		const unsigned int* partial = partialCounts[i - 1].constData();
+		for(int j = 0; j < numBins; j++)
+		{
+			counts[j] += partial[j];
+		}
+	}
+	return binned;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::BinTask(Task* task)
+{
+	const float* x = task->X;
+	const float* y = task->Y;
+	unsigned int* counts = task->Counts;
+	int width = task->Width;
+	int height = task->Height;
+
+	int binned = 0;
+	for(int i = task->Start; i < task->End; i++)
+	{
+		double fx = (x[i] - task->XMin) * task->XScale;
+		double fy = (y[i] - task->YMin) * task->YScale;
+
+		// Written so that NaN values are skipped too. Points on the range maximum go to the last bin.
+		if(!(fx >= 0 && fx <= width && fy >= 0 && fy <= height)) continue;
+		int ix = fx < width ? (int)fx : width - 1;
+		int iy = fy < height ? (int)fy : height - 1;
+
+		counts[iy * width + ix]++;
+		binned++;
+	}
+	return binned;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::BinPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+	int length, const double* ranges, int size, unsigned int* counts)
+{
+	return BinColumnPairs(columns, numColumns, mask, maskBits, length, ranges, size, false, counts);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::BinAdjacentPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+	int length, const double* ranges, int size, unsigned int* counts)
+{
+	return BinColumnPairs(columns, numColumns, mask, maskBits, length, ranges, size, true, counts);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::BinColumnPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+	int length, const double* ranges, int size, bool adjacent, unsigned int* counts)
+{
+	int numPairs = adjacent ? numColumns - 1 : numColumns * (numColumns - 1) / 2;
+	int pairBins = size * size;
+	if(numPairs <= 0 || size <= 0) return 0;
+	memset(counts, 0, sizeof(unsigned int) * numPairs * pairBins);
+	if(length <= 0) return 0;
+
+	// Each row visit updates all the pairs, so tasks can be smaller than in Bin.
+	int numTasks = qMin(QThread::idealThreadCount(), length / qMax(1, MIN_POINTS_PER_TASK / numPairs));
+	numTasks = qMin(numTasks, length);
+	if(numTasks < 1) numTasks = 1;
+	int chunkSize = (length + numTasks - 1) / numTasks;
+
+	QVector<PairTask> tasks(numTasks);
+	QVector< QVector<unsigned int> > partialCounts(numTasks - 1);
+	for(int i = 0; i < numTasks; i++)
+	{
+		PairTask& task = tasks[i];
+		task.Columns = columns;
+		task.NumColumns = numColumns;
+		task.Mask = mask;
+		task.MaskBits = maskBits;
+		task.Start = i * chunkSize;
+		task.End = qMin(length, (i + 1) * chunkSize);
+		task.Ranges = ranges;
+		task.Size = size;
+		task.Adjacent = adjacent;
+		if(i == 0)
+		{
+			task.Counts = counts;
+		}
+		else
+		{
+			partialCounts[i - 1].fill(0, numPairs * pairBins);
+			task.Counts = partialCounts[i - 1].data();
+		}
+	}
+
+	QList< QFuture<int> > futures;
+	for(int i = 1; i < numTasks; i++)
+	{
+		futures.append(QtConcurrent::run(&DensityBinner::BinPairsTask, &tasks[i]));
+	}
+	int visited = BinPairsTask(&tasks[0]);
+
+	// Reduce the partial histograms.
+	for(int i = 1; i < numTasks; i++)
+	{
+		visited += futures[i - 1].result();
+		const unsigned int* partial = partialCounts[i - 1].constData();
+		for(int j = 0; j < numPairs * pairBins; j++)
+		{
+			counts[j] += partial[j];
+		}
+	}
+	return visited;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int DensityBinner::BinPairsTask(PairTask* task)
+{
+	int numColumns = task->NumColumns;
+	int size = task->Size;
+	int pairBins = size * size;
+
+	QVector<double> scales(numColumns);
+	for(int c = 0; c < numColumns; c++)
+	{
+		double extent = task->Ranges[c * 2 + 1] - task->Ranges[c * 2];
+		scales[c] = extent > 0 ? size / extent : 0;
+	}
+
+	// Each row value is binned once per column, then the bin indices are combined for all the pairs.
+	QVector<int> bins(numColumns);
+	int visited = 0;
+	for(int i = task->Start; i < task->End; i++)
+	{
+		if(task->Mask != NULL && (task->Mask[i] & task->MaskBits) != task->MaskBits) continue;
+		visited++;
+
+		for(int c = 0; c < numColumns; c++)
+		{
+			double f = (task->Columns[c][i] - task->Ranges[c * 2]) * scales[c];
+			// Written so that NaN values are skipped too. Values on the range maximum go to the last bin.
+			if(!(f >= 0 && f <= size)) bins[c] = -1;
+			else bins[c] = f < size ? (int)f : size - 1;
+		}
+
+		unsigned int* counts = task->Counts;
+		if(task->Adjacent)
+		{
+			for(int c = 0; c + 1 < numColumns; c++)
+			{
+				if(bins[c] >= 0 && bins[c + 1] >= 0) counts[bins[c + 1] * size + bins[c]]++;
+				counts += pairBins;
+			}
+			continue;
+		}
+		for(int c1 = 0; c1 < numColumns; c1++)
+		{
+			int b1 = bins[c1];
+			if(b1 < 0)
+			{
+				counts += pairBins * (numColumns - c1 - 1);
+				continue;
+			}
+			for(int c2 = c1 + 1; c2 < numColumns; c2++)
+			{
+				if(bins[c2] >= 0) counts[bins[c2] * size + b1]++;
+				counts += pairBins;
+			}
+		}
+	}
+	return visited;
+}
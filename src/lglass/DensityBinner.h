@@ -0,0 +1,103 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef DENSITYBINNER_H
+#define DENSITYBINNER_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bins (x, y) point pairs into a 2D histogram. The point arrays are split into chunks binned in 
+// parallel, each into a private histogram, and the partial histograms are then summed.
+class DensityBinner
+{
+public:
+	// Minimum number of points binned by each task.
+	static const int MIN_POINTS_PER_TASK = 65536;
+
+public:
+	// Bins the points lying inside xRange and yRange into a width x height grid of counts, stored
+	// in row order starting from the minimum y. Returns the number of binned points.
+	static int Bin(const float* x, const float* y, int length, 
+		const double xRange[2], const double yRange[2], int width, int height, unsigned int* counts);
+
+	// Bins all the column pairs (i, j) with i < j into size x size histograms, in a single pass over the rows.
+	// Only rows whose mask has all the maskBits set are binned (all rows if mask is NULL). ranges holds the
+	// (min, max) range of each column. Pair histograms are stored one after the other in counts, in (0, 1), 
+	// (0, 2) ... (1, 2) ... order, each in row order with x along column i and y along column j.
+	// Returns the number of visited rows.
+	static int BinPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+		int length, const double* ranges, int size, unsigned int* counts);
+
+	// Same as BinPairs, but only bins the adjacent column pairs (i, i + 1): counts holds numColumns - 1 histograms.
+	static int BinAdjacentPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+		int length, const double* ranges, int size, unsigned int* counts);
+
+	// Returns the index of the (i, j) pair histogram in the output of BinPairs.
+	static int GetPairIndex(int i, int j, int numColumns) { return i * (2 * numColumns - i - 1) / 2 + j - i - 1; }
+
+private:
+	struct Task
+	{
+		const float* X;
+		const float* Y;
+		int Start;
+		int End;
+		double XMin;
+		double YMin;
+		double XScale;
+		double YScale;
+		int Width;
+		int Height;
+		unsigned int* Counts;
+	};
+
+	struct PairTask
+	{
+		const float* const* Columns;
+		int NumColumns;
+		const unsigned char* Mask;
+		int MaskBits;
+		int Start;
+		int End;
+		const double* Ranges;
+		int Size;
+		bool Adjacent;
+		unsigned int* Counts;
+	};
+
+	static int BinColumnPairs(const float* const* columns, int numColumns, const unsigned char* mask, int maskBits, 
+		int length, const double* ranges, int size, bool adjacent, unsigned int* counts);
+	static int BinTask(Task* task);
+	static int BinPairsTask(PairTask* task);
+};
+
+#endif
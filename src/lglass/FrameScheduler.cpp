@@ -0,0 +1,130 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "FrameScheduler.h"
+#include "DockedTool.h"
+#include "VisualizationManagerBase.h"
+
+#include <QTimer>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FrameScheduler::FrameScheduler(VisualizationManagerBase* mng):
+	myMng(mng),
+	myRenderDirty(false),
+	myNumRequests(0),
+	myNumCoalesced(0),
+	myNumFrames(0)
+{
+	myTimer = new QTimer(this);
+	myTimer->setSingleShot(true);
+	connect(myTimer, SIGNAL(timeout()), SLOT(OnFrameTimer()));
+
+	myFrameClock.start();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FrameScheduler::~FrameScheduler()
+{
+	myTimer->stop();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::RequestRender()
+{
+	myNumRequests++;
+	if(myRenderDirty)
+	{
+		myNumCoalesced++;
+		return;
+	}
+	myRenderDirty = true;
+	Schedule();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::RequestUpdate(DockedTool* view)
+{
+	myNumRequests++;
+	if(myDirtyViews.contains(view))
+	{
+		myNumCoalesced++;
+		return;
+	}
+	myDirtyViews.append(view);
+	Schedule();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::Schedule()
+{
+	if(myTimer->isActive()) return;
+
+	// Wait for the end of the current event loop turn, but never run frames faster than the refresh rate.
+	int elapsed = myFrameClock.elapsed();
+	int delay = elapsed < MIN_FRAME_INTERVAL ? MIN_FRAME_INTERVAL - elapsed : 0;
+	myTimer->start(delay);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::Flush()
+{
+	myTimer->stop();
+	OnFrameTimer();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::OnFrameTimer()
+{
+	if(!myRenderDirty && myDirtyViews.isEmpty()) return;
+
+	// Clear the dirty state before running the frame, so requests issued by the views themselves 
+	// schedule a new frame instead of being lost.
+	QList<DockedTool*> views = myDirtyViews;
+	bool render = myRenderDirty;
+	myDirtyViews.clear();
+	myRenderDirty = false;
+
+	foreach(DockedTool* view, views)
+	{
+		view->Update();
+	}
+	if(render) myMng->Render();
+
+	myNumFrames++;
+	myFrameClock.restart();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::ResetCounters()
+{
+	myNumRequests = 0;
+	myNumCoalesced = 0;
+	myNumFrames = 0;
+}
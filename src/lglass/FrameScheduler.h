@@ -0,0 +1,91 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+
+#include <QList>
+#include <QTime>
+
+class QTimer;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Merges view update and main window render requests into frames. Requests only mark their target
+// dirty: all the requests issued during an event loop turn are served by a single frame, and frames
+// are never run more often than MIN_FRAME_INTERVAL milliseconds apart. 
+class FrameScheduler: public QObject
+{
+	Q_OBJECT
+public:
+	// Minimum time between two frames, in milliseconds (about one refresh at 60Hz).
+	static const int MIN_FRAME_INTERVAL = 16;
+
+public:
+	FrameScheduler(VisualizationManagerBase* mng);
+	~FrameScheduler();
+
+	// Marks the main render window as needing a redraw.
+	void RequestRender();
+	// Marks a docked view as needing an update.
+	void RequestUpdate(DockedTool* view);
+	// Runs the pending frame immediately, if any. Used before screenshots, so that they include the pending updates.
+	void Flush();
+
+	// Counters, reset every time they are reported.
+	int GetNumRequests() { return myNumRequests; }
+	int GetNumCoalesced() { return myNumCoalesced; }
+	int GetNumFrames() { return myNumFrames; }
+	void ResetCounters();
+
+private slots:
+	void OnFrameTimer();
+
+private:
+	void Schedule();
+
+private:
+	VisualizationManagerBase* myMng;
+	QTimer* myTimer;
+	QTime myFrameClock;
+
+	// Dirty state.
+	bool myRenderDirty;
+	QList<DockedTool*> myDirtyViews;
+
+	// Counters.
+	int myNumRequests;
+	int myNumCoalesced;
+	int myNumFrames;
+};
+
+#endif
@@ -1,645 +1,750 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "AppConfig.h"
-#include "DataSet.h"
-#include "NavigationView.h"
-#include "VisualizationManager.h"
-#include "RepositoryManager.h"
-
-#include <QTextStream>
-#include <QTimer>
-
-#include <vtkActor.h>
-#include <vtkCellArray.h>
-#include <vtkDataSetMapper.h>
-#include <vtkImageData.h>
-#include <vtkPlane.h>
-#include <vtkPlaneSource.h>
-#include <vtkPNGReader.h>
-#include <vtkPolyDataMapper.h>
-#include <vtkProperty.h>
-#include <vtkRenderer.h>
-#include <vtkSphereSource.h>
-#include <vtkTexture.h>
-
-using namespace libconfig;
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-ImageOverlay::ImageOverlay(VisualizationManager* mng):
-	myVizMng(mng)
-{
-	myOverlayReader = vtkPNGReader::New();
-
-	myOverlayTexture = vtkTexture::New();
-	myOverlayTexture->SetInput(myOverlayReader->GetOutput());
-	myOverlayTexture->InterpolateOn();
-
-	myOverlayPlane = vtkPlaneSource::New();
-	myOverlayPlane->SetOrigin(0, 0, 0);
-	myOverlayPlane->SetPoint2(0, 0, -1);
-	myOverlayPlane->SetPoint1(2, 0, 0);
-	myOverlayPlane->SetCenter(0, 0, 0);
-
-	myOverlayMapper = vtkPolyDataMapper::New();
-	myOverlayMapper = vtkPolyDataMapper::New();
-	myOverlayMapper->SetInput(myOverlayPlane->GetOutput());
-
-	myOverlayActor = vtkActor::New();
-	myOverlayActor->SetMapper(myOverlayMapper);
-	myOverlayActor->SetTexture(myOverlayTexture);
-	myOverlayActor->SetOrientation(0, 120, 0);
-	myOverlayActor->PickableOff();
-	myOverlayActor->GetProperty()->SetLighting(0);
-
-	myLabelActor = vtkTextActor3D::New();
-	myLabelActor->SetInput("Hello World!");
-	myLabelActor->SetOrientation(-90, 60, 0);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-ImageOverlay::~ImageOverlay()
-{
-	myOverlayReader->Delete();
-	myOverlayTexture->Delete();
-	myOverlayPlane->Delete();
-	myOverlayMapper->Delete();
-	myOverlayActor->Delete();
-	myLabelActor->Delete();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ImageOverlay::SetTexture(const char* imagePathFormat, const char* imgPath)
-{
-	char path[DEFAULT_STRING];
-	sprintf(path, imagePathFormat, imgPath);
-	myOverlayReader->SetFileName(path);
-	myOverlayReader->Update();
-	myOverlayMapper->Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ImageOverlay::SetPosition(float X, float Y)
-{
-	myOverlayActor->SetPosition(X, 4, Y);
-	myLabelActor->SetPosition(X, 3, Y);
-	this->X = X;
-	this->Y = Y;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ImageOverlay::SetSize(float size)
-{
-	myOverlayActor->SetScale(-size, 1, -size);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void ImageOverlay::SetVisible(bool visible)
-{
-	vtkRenderer* renderer = myVizMng->GetMainRenderer();
-	if(visible)
-	{
-		renderer->AddActor(myOverlayActor);
-		//renderer->AddActor(myLabelActor);
-	}
-	else
-	{
-		renderer->RemoveActor(myOverlayActor);
-		//renderer->RemoveActor(myLabelActor);
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-NavigationView::NavigationView(VisualizationManager* mng): 
-	DockedTool(mng, "Mission Replay", Qt::BottomDockWidgetArea),
-	myMissionPathColor(255, 106, 0),
-	myDepthScale(7),
-	PathDecimation(5),
-	PathDepthOffset(4),
-	ImagePathFormat("G:/bonney_2009/%s"),
-	MissionDataPathFormat("/nav09/%s"),
-	ImageExportPathFormat("./data/ExportedImages/%d_%d_%d_%f.png"),
-	IcePickingThreshold(4.5f)
-{
-	myVizMng = mng;
-	GetMenuAction()->setIcon(QIcon(":/icons/NavigationView.png"));
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-NavigationView::~NavigationView()
-{
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::Initialize()
-{
-	SetupUI();
-
-	// Create the VTK objects.
-	myMissionPathData = vtkPolyData::New();
-	myMissionPathMapper = vtkPolyDataMapper::New();
-	myMissionPathActor = vtkActor::New();
-	myMissionPathActor->SetVisibility(0);
-
-	// Initalize the AUV object
-	myAUVSource = vtkSphereSource::New();
-	myAUVMapper = vtkPolyDataMapper::New();
-	myAUVActor = vtkActor::New();
-
-	myAUVSource->SetPhiResolution(5);
-	myAUVSource->SetThetaResolution(5);
-	myAUVMapper->SetInput(myAUVSource->GetOutput());
-	myAUVActor->SetMapper(myAUVMapper);
-	myAUVActor->SetVisibility(0);
-	myVizMng->GetMainRenderer()->AddActor(myAUVActor);
-
-	// Initialize image overlays
-	for(int i = 0; i < MAX_IMAGE_OVERLAYS; i++)
-	{
-		myOverlays[i] = new ImageOverlay(myVizMng);
-	}
-
-	// TODO: Endurance hack.
-	LoadMissionSet("Bonney2009");
-
-	SetMissionPathColor(myMissionPathColor);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::LoadMissionSet(QString setName)
-{
-	Config* c = AppConfig::GetInstance()->GetDataConfig();
-	QString section = QString("Application/NavigationView/%1").arg(setName);
-	if(!c->exists(section))
-	{
-		Console::Error(QString("Missing config section %1: wrong configuration file?").arg(setName));
-		ShutdownApp(true);
-	}
-
-	Setting& missionSet = c->lookup(section);
-
-	ImagePathFormat = (string)missionSet["ImagePathFormat"];
-	ImageExportPathFormat = (string)missionSet["ImageExportPathFormat"];
-	MissionDataPathFormat = (string)missionSet["MissionDataPathFormat"];
-
-	MissionFiles.clear();
-
-	Setting& files = missionSet["MissionFiles"];
-	for(int i = 0; i < files.getLength(); i++)
-	{
-		MissionFiles.push_back((string)files[i]);
-	}
-
-	// Setup the mission box.
-	myUI->diveBox->clear();
-	for(int i = 0; i < MissionFiles.size(); i++)
-	{
-		myUI->diveBox->addItem(MissionFiles[i].c_str());
-	}
-
-	LoadMission(0);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::LoadMission(int num)
-{
-	// Count the number of items.
-	char path[DEFAULT_STRING];
-	sprintf(path, MissionDataPathFormat.c_str(), MissionFiles[num].c_str());
-
-
-	QFile* file = RepositoryManager::GetInstance()->TryOpen(path);//fopen(path, "r");
-	if(!file)
-	{
-		Console::Error(QString("Opening navigation file %1 failed.").arg(path));
-		return;
-	}
-	
-	QTextStream dataFile(file);
-
-	myNavigationViewDataLength = 0;
-	while (!dataFile.atEnd())
-    {
-		QString line = dataFile.readLine();
-		myNavigationViewDataLength++;
-	}
-	// Ignore first line.
-	myNavigationViewDataLength--;
-	
-	file->seek(0);
-
-	printf("Mission data length: %d\n", myNavigationViewDataLength);
-
-    // process the first line which is a header
-	QString line = dataFile.readLine();
-	int i = 0;
-    while (!dataFile.atEnd())
-    {
-		float x, y, depth;
-		int timestamp;
-
-		QString line =  dataFile.readLine();
-
-		//%Timestamp X Y Depth ImageName
-        int l = sscanf(line, "%d %f %f %f %s", &timestamp, &x, &y, &depth, myNavigationViewData[i].UPImageName);
-
-		myNavigationViewData[i].X = x;
-		myNavigationViewData[i].Y = y;
-		myNavigationViewData[i].Depth = depth;
-		myNavigationViewData[i].Timestamp = timestamp;
-		//strcpy(myNavigationViewData[i].Log, ((char*)line.data()) + 48 + strlen(myNavigationViewData[i].UPImageName));
-
-		i++;
-    }
-
-	// close and free up file.
-	file->close();
-	delete file;
-	file = NULL;
-
-	// Setup the polydata.
-	vtkPoints* pts = vtkPoints::New();
-	vtkCellArray* cells = vtkCellArray::New();
-	pts->SetNumberOfPoints(myNavigationViewDataLength);
-	int numPts = 0;
-	for(int i = 0; i < myNavigationViewDataLength; i++)
-	{
-		if(i % PathDecimation == 0)
-		{
-			pts->SetPoint(numPts, myNavigationViewData[i].X, -myNavigationViewData[i].Depth, myNavigationViewData[i].Y);
-			if(i < myNavigationViewDataLength - PathDecimation)
-			{
-				cells->InsertNextCell(2);
-				cells->InsertCellPoint(numPts);
-				cells->InsertCellPoint(numPts + 1);
-			}
-			numPts++;
-		}
-	}
-	myMissionPathData->Allocate(myNavigationViewDataLength, myNavigationViewDataLength);
-	myMissionPathData->SetPoints(pts);
-	myMissionPathData->SetLines(cells);
-
-	cells->Delete();
-	pts->Delete();
-
-	//double* range = outline->GetOutput()->GetBounds();
-	//printf("Mission Range: %f-%f %f-%f %f-%f\n", range[0], range[1], range[2], range[3], range[4], range[5]);
-
-	myMissionPathMapper->SetInput(myMissionPathData);
-	myMissionPathMapper->Update();
-
-	myMissionPathActor->SetMapper(myMissionPathMapper);
-	myMissionPathActor->SetPosition(0, PathDepthOffset * myDepthScale, 0);
-	myMissionPathActor->SetScale(1, myDepthScale, 1);
-	myMissionPathActor->GetProperty()->SetLineWidth(1);
-	myMissionPathActor->GetProperty()->SetRepresentationToPoints();
-
-	myVizMng->GetMainRenderer()->AddActor(myMissionPathActor);
-	myVizMng->Render();
-
-	myLogIndex = 0;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::SetupUI()
-{
-	myUI = new Ui::NavigationViewDock();
-	myUI->setupUi(GetDockWidget());
-
-	myTimer = new QTimer();
-
-	myUI->imgDistanceSlider->setValue(50);
-	OnImgDistanceSliderValueChanged(50);
-
-	// Wire events.
-	connect(myUI->timeSlider, SIGNAL(sliderMoved(int)),
-		SLOT(OnTimeSliderValueChanged(int)));
-
-	connect(myUI->imgDistanceSlider, SIGNAL(sliderMoved(int)),
-		SLOT(OnImgDistanceSliderValueChanged(int)));
-
-	connect(myTimer, SIGNAL(timeout()),
-		SLOT(OnTimerTick()));
-
-	connect(myUI->diveBox, SIGNAL(currentIndexChanged(int)),
-		SLOT(OnDiveBoxChanged(int)));
-
-	connect(myUI->timeBackButton, SIGNAL(clicked()), 
-		SLOT(OnTimeBackButtonClick()));
-
-	connect(myUI->timeForwardButton, SIGNAL(clicked()), 
-		SLOT(OnTimeForwardButtonClick()));
-
-	connect(myUI->showMissionButton, SIGNAL(toggled(bool)), 
-		SLOT(OnShowMissionButtonToggle(bool)));
-
-	connect(myUI->imgEnabledButton, SIGNAL(toggled(bool)), 
-		SLOT(OnImgEnabledButtonButtonToggle(bool)));
-
-	connect(myUI->playButton, SIGNAL(toggled(bool)), 
-		SLOT(OnPlayButtonToggle(bool)));
-
-	connect(myUI->exportImageButton, SIGNAL(clicked()), 
-		SLOT(OnExportImageButtonClick()));
-
-	connect(myUI->imgUpdateButton, SIGNAL(clicked()), 
-		SLOT(OnImgUpdateButtonClick()));
-
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::Update()
-{
-	NavigationViewItem* item = &myNavigationViewData[myPlayIndex];
-
-	time_t time = item->Timestamp;
-	tm* ptm = gmtime(&time);
-
-	myUI->timeLabel->setText(asctime(ptm));
-
-	myAUVActor->SetPosition(item->X, (-item->Depth + PathDepthOffset) * myDepthScale , item->Y);
-	myAUVActor->SetScale(6, 6, 6);
-	myAUVActor->GetProperty()->SetLighting(0);
-	myAUVActor->GetProperty()->SetColor(0, 1, 1);
-	myAUVActor->GetProperty()->BackfaceCullingOff();
-	myAUVActor->GetProperty()->FrontfaceCullingOff();
-	myVizMng->Render();
-
-	// Print log message.
-	if(myPlayIndex > myLogIndex)
-	{
-		for(int i = myLogIndex; i < myPlayIndex; i++)
-		{
-			if(strlen(myNavigationViewData[i].Log) > 2)
-			{
-				time_t ltime = myNavigationViewData[i].Timestamp;
-				tm* lptm = gmtime(&ltime);
-				char str[DEFAULT_STRING * 4];
-				sprintf(str, "%d:%d:%d - %s", ptm->tm_hour, ptm->tm_min, ptm->tm_sec, myNavigationViewData[i].Log);
-				str[strlen(str) - 1] = '\0';
-				myUI->logView->addItem(str);
-			}
-			myVizMng->SetStatusbarMessage(QString("X: %1    Y: %2   Depth: %3")
-				.arg(myNavigationViewData[i].X)
-				.arg(myNavigationViewData[i].Y)
-				.arg(myNavigationViewData[i].Depth));
-		}
-	}
-	myUI->logView->scrollToBottom();
-	myLogIndex = myPlayIndex;
-
-	// Update camera images.
-	if(item->UPImageName[0] != '#')
-	{
-		char path[DEFAULT_STRING];
-		sprintf(path, ImagePathFormat.c_str(), item->UPImageName);
-		myUpImage.load(path);
-		myUI->upView->setPixmap(myUpImage);
-	}
-	else
-	{
-		// Hack - to avoid sparse empty images - this problem should actually
-		// be solved inside the preprocessing tool.
-		if(myNavigationViewData[myPlayIndex + 1].UPImageName[0] == '#')
-		{
-			myUI->upView->clear();
-		}
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::UpdateImageOverlays()
-{
-	myOverlayStartIndex = 0;
-	
-	for(int i = 0; i < MAX_IMAGE_OVERLAYS; i++)
-	{
-		vtkRenderer* renderer = myVizMng->GetMainRenderer();
-		myOverlays[i]->SetVisible(false);
-	}
-
-	int lastIndex = 0;
-	int overlayIndex = 0;
-	// STEP 1: Always add images closer to the ice surface.
-	//for(int i = myOverlayStartIndex; i < myNavigationViewDataLength; i++)
-	//{
-	//	// if this data point has no associated image, skip it.
-	//	if(myNavigationViewData[i].UPImageName[0] != '#')
-	//	{
-	//		if(myNavigationViewData[i].Depth < IcePickingThreshold)
-	//		{
-	//			// Check to see if image is not too close to other already added overlays
-	//			bool ok = true;
-	//			for(int j = 0; j < overlayIndex; j++)
-	//			{
-	//				float dx2 = myNavigationViewData[i].X - myOverlays[j]->X;
-	//				float dy2 = myNavigationViewData[i].Y - myOverlays[j]->Y;
-	//				float d2 = sqrt(dx2 * dx2 + dy2 * dy2);
-	//				if(d2 < 30)
-	//				{
-	//					ok = false;
-	//					break;
-	//				}
-	//			}
-	//			if(ok)
-	//			{
-	//				// If distance check is ok, create a new image overlay from this data point.
-	//				myOverlays[overlayIndex]->Index = i;
-	//				myOverlays[overlayIndex]->SetTexture(ImagePathFormat.c_str(), myNavigationViewData[i].UPImageName);
-	//				myOverlays[overlayIndex]->SetPosition(myNavigationViewData[i].X, myNavigationViewData[i].Y);
-	//				// Scale image overlay depending on overlay distance.
-	//				myOverlays[overlayIndex]->SetSize(myOverlayDistance / 1.5f);
-	//				myOverlays[overlayIndex]->SetVisible(true);
-	//				overlayIndex++;
-	//				lastIndex = i;
-	//			}
-	//		}
-	//	}
-	//}
-
-	for(int i = myOverlayStartIndex; i < myNavigationViewDataLength; i++)
-	{
-		// if this data point has no associated image, skip it.
-		if(myNavigationViewData[i].UPImageName[0] != '#')
-		{
-			// Check to see if image is not too close to other already added overlays
-			bool ok = true;
-			for(int j = 0; j < overlayIndex; j++)
-			{
-				float dx2 = myNavigationViewData[i].X - myOverlays[j]->X;
-				float dy2 = myNavigationViewData[i].Y - myOverlays[j]->Y;
-				float d2 = sqrt(dx2 * dx2 + dy2 * dy2);
-				if(d2 < myOverlayDistance)
-				{
-					ok = false;
-					break;
-				}
-			}
-			if(ok)
-			{
-				// If distance check is ok, create a new image overlay from this data point.
-				myOverlays[overlayIndex]->Index = i;
-				myOverlays[overlayIndex]->SetTexture(ImagePathFormat.c_str(), myNavigationViewData[i].UPImageName);
-				myOverlays[overlayIndex]->SetPosition(myNavigationViewData[i].X, myNavigationViewData[i].Y);
-				// Scale image overlay depending on overlay distance.
-				myOverlays[overlayIndex]->SetSize(myOverlayDistance / 1.5f);
-				myOverlays[overlayIndex]->SetVisible(true);
-				overlayIndex++;
-				lastIndex = i;
-			}
-		}
-	}
-	myActiveOverlays = overlayIndex;
-	myUI->imgEnabledButton->setChecked(true);
-	myVizMng->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::SetMissionPathColor(QColor value)
-{
-	myMissionPathColor = value;
-	myMissionPathActor->GetProperty()->SetColor(QCOLOR_TO_VTK(myMissionPathColor));
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnShowMissionButtonToggle(bool value)
-{
-	myAUVActor->SetVisibility(value);
-	myMissionPathActor->SetVisibility(value);
-	if(value)
-	{
-		OnTimeSliderValueChanged(myUI->timeSlider->value());
-	}
-	myVizMng->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnTimeSliderValueChanged(int value)
-{
-	myPlayIndex = myNavigationViewDataLength * value / myUI->timeSlider->maximum();
-	Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnDiveBoxChanged(int value)
-{
-	LoadMission(value);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnTimerTick()
-{
-	myPlayIndex++;
-	if(myPlayIndex == myNavigationViewDataLength)
-	{
-		myTimer->stop();
-		myUI->playButton->setChecked(false);
-	}
-	else
-	{
-		Update();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnPlayButtonToggle(bool value)
-{
-	if(value)
-	{
-		myTimer->start(200, false);
-	}
-	else
-	{
-		myTimer->stop();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnTimeForwardButtonClick()
-{
-	if(myPlayIndex < myNavigationViewDataLength - 1)
-	{
-		myPlayIndex++;
-		Update();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnTimeBackButtonClick()
-{
-	if(myPlayIndex > 0)
-	{
-		myPlayIndex--;
-		Update();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnExportImageButtonClick()
-{
-	for(int i = 0; i < myActiveOverlays; i++)
-	{
-		int idx = myOverlays[i]->Index;
-		char path[DEFAULT_STRING];
-		sprintf(path, ImagePathFormat.c_str(), myNavigationViewData[idx].UPImageName);
-		QFile* source = new QFile(path);
-		sprintf(path, ImageExportPathFormat.c_str(), 
-			myNavigationViewData[idx].Timestamp,
-			(int)myNavigationViewData[idx].X,
-			(int)myNavigationViewData[idx].Y,
-			myNavigationViewData[idx].Depth);
-		source->copy(path);
-		delete source;
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnImgUpdateButtonClick()
-{
-	UpdateImageOverlays();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnImgDistanceSliderValueChanged(int value)
-{
-	myOverlayDistance = value;
-	myUI->imgDistanceLabel->setText(QString("Image Distance: %1 meters").arg(value));
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void NavigationView::OnImgEnabledButtonButtonToggle(bool value)
-{
-	for(int i = 0; i < myActiveOverlays; i++)
-	{
-		myOverlays[i]->SetVisible(value);
-	}
-	myVizMng->Render();
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "AppConfig.h"
+#include "DataSet.h"
+#include "NavigationView.h"
+#include "VisualizationManager.h"
+#include "RepositoryManager.h"
+
+#include <QTimer>
+
+#include <vtkActor.h>
+#include <vtkCellArray.h>
+#include <vtkDataSetMapper.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkImageData.h>
+#include <vtkPlane.h>
+#include <vtkPlaneSource.h>
+#include <vtkPNGReader.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+#include <vtkTexture.h>
+
+#include <math.h>
+#include <string.h>
+
+using namespace libconfig;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ImageOverlay::ImageOverlay(VisualizationManager* mng):
+	myVizMng(mng)
+{
+	myOverlayReader = vtkPNGReader::New();
+
+	myOverlayTexture = vtkTexture::New();
+	myOverlayTexture->SetInput(myOverlayReader->GetOutput());
+	myOverlayTexture->InterpolateOn();
+
+	myOverlayPlane = vtkPlaneSource::New();
+	myOverlayPlane->SetOrigin(0, 0, 0);
+	myOverlayPlane->SetPoint2(0, 0, -1);
+	myOverlayPlane->SetPoint1(2, 0, 0);
+	myOverlayPlane->SetCenter(0, 0, 0);
+
+	myOverlayMapper = vtkPolyDataMapper::New();
+	myOverlayMapper = vtkPolyDataMapper::New();
+	myOverlayMapper->SetInput(myOverlayPlane->GetOutput());
+
+	myOverlayActor = vtkActor::New();
+	myOverlayActor->SetMapper(myOverlayMapper);
+	myOverlayActor->SetTexture(myOverlayTexture);
+	myOverlayActor->SetOrientation(0, 120, 0);
+	myOverlayActor->PickableOff();
+	myOverlayActor->GetProperty()->SetLighting(0);
+
+	myLabelActor = vtkTextActor3D::New();
+	myLabelActor->SetInput("Hello World!");
+	myLabelActor->SetOrientation(-90, 60, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ImageOverlay::~ImageOverlay()
+{
+	myOverlayReader->Delete();
+	myOverlayTexture->Delete();
+	myOverlayPlane->Delete();
+	myOverlayMapper->Delete();
+	myOverlayActor->Delete();
+	myLabelActor->Delete();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ImageOverlay::SetTexture(const char* imagePathFormat, const char* imgPath)
+{
+	// Image names come from the mission files and have no length limit: format them into a QString.
+	QString path;
+	path.sprintf(imagePathFormat, imgPath);
+	myOverlayReader->SetFileName(path.ascii());
+	myOverlayReader->Update();
+	myOverlayMapper->Update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ImageOverlay::SetPosition(float X, float Y)
+{
+	myOverlayActor->SetPosition(X, 4, Y);
+	myLabelActor->SetPosition(X, 3, Y);
+	this->X = X;
+	this->Y = Y;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ImageOverlay::SetSize(float size)
+{
+	myOverlayActor->SetScale(-size, 1, -size);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ImageOverlay::SetVisible(bool visible)
+{
+	vtkRenderer* renderer = myVizMng->GetMainRenderer();
+	if(visible)
+	{
+		renderer->AddActor(myOverlayActor);
+		//renderer->AddActor(myLabelActor);
+	}
+	else
+	{
+		renderer->RemoveActor(myOverlayActor);
+		//renderer->RemoveActor(myLabelActor);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+NavigationView::NavigationView(VisualizationManager* mng): 
+	DockedTool(mng, "Mission Replay", Qt::BottomDockWidgetArea),
+	myMissionPathColor(255, 106, 0),
+	myDepthScale(7),
+	PathDecimation(5),
+	PathDepthOffset(4),
+	ImagePathFormat("G:/bonney_2009/%s"),
+	MissionDataPathFormat("/nav09/%s"),
+	ImageExportPathFormat("./data/ExportedImages/%d_%d_%d_%f.png"),
+	IcePickingThreshold(4.5f)
+{
+	myVizMng = mng;
+	GetMenuAction()->setIcon(QIcon(":/icons/NavigationView.png"));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+NavigationView::~NavigationView()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::Initialize()
+{
+	SetupUI();
+
+	// Create the VTK objects.
+	myMissionPathData = vtkPolyData::New();
+	myMissionPathMapper = vtkPolyDataMapper::New();
+	myMissionPathActor = vtkActor::New();
+	myMissionPathActor->SetVisibility(0);
+
+	// Initalize the AUV object
+	myAUVSource = vtkSphereSource::New();
+	myAUVMapper = vtkPolyDataMapper::New();
+	myAUVActor = vtkActor::New();
+
+	myAUVSource->SetPhiResolution(5);
+	myAUVSource->SetThetaResolution(5);
+	myAUVMapper->SetInput(myAUVSource->GetOutput());
+	myAUVActor->SetMapper(myAUVMapper);
+	myAUVActor->SetVisibility(0);
+	myVizMng->GetMainRenderer()->AddActor(myAUVActor);
+
+	// Initialize image overlays
+	for(int i = 0; i < MAX_IMAGE_OVERLAYS; i++)
+	{
+		myOverlays[i] = new ImageOverlay(myVizMng);
+	}
+
+	// TODO: Endurance hack.
+	LoadMissionSet("Bonney2009");
+
+	SetMissionPathColor(myMissionPathColor);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::LoadMissionSet(QString setName)
+{
+	Config* c = AppConfig::GetInstance()->GetDataConfig();
+	QString section = QString("Application/NavigationView/%1").arg(setName);
+	if(!c->exists(section))
+	{
+		Console::Error(QString("Missing config section %1: wrong configuration file?").arg(setName));
+		ShutdownApp(true);
+	}
+
+	Setting& missionSet = c->lookup(section);
+
+	ImagePathFormat = (string)missionSet["ImagePathFormat"];
+	ImageExportPathFormat = (string)missionSet["ImageExportPathFormat"];
+	MissionDataPathFormat = (string)missionSet["MissionDataPathFormat"];
+
+	MissionFiles.clear();
+
+	Setting& files = missionSet["MissionFiles"];
+	for(int i = 0; i < files.getLength(); i++)
+	{
+		MissionFiles.push_back((string)files[i]);
+	}
+
+	// Setup the mission box.
+	myUI->diveBox->clear();
+	for(int i = 0; i < MissionFiles.size(); i++)
+	{
+		myUI->diveBox->addItem(MissionFiles[i].c_str());
+	}
+
+	LoadMission(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Parses a decimal number starting at p, skipping leading blanks. Returns a pointer past the number, or NULL
+// if no number was found before end. Unlike sscanf / strtod this never reads past end, and does not depend
+// on the current locale.
+static const char* ParseNumber(const char* p, const char* end, double* value)
+{
+	while(p < end && (*p == ' ' || *p == '\t')) p++;
+
+	bool negative = false;
+	if(p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+	double mantissa = 0;
+	int exponent = 0;
+	int digits = 0;
+	for(; p < end && *p >= '0' && *p <= '9'; p++, digits++) mantissa = mantissa * 10 + (*p - '0');
+	if(p < end && *p == '.')
+	{
+		for(p++; p < end && *p >= '0' && *p <= '9'; p++, digits++, exponent--) mantissa = mantissa * 10 + (*p - '0');
+	}
+	if(digits == 0) return NULL;
+
+	if(p < end && (*p == 'e' || *p == 'E'))
+	{
+		const char* q = p + 1;
+		bool negativeExp = false;
+		if(q < end && (*q == '-' || *q == '+')) negativeExp = (*q++ == '-');
+		if(q < end && *q >= '0' && *q <= '9')
+		{
+			int e = 0;
+			for(; q < end && *q >= '0' && *q <= '9'; q++) e = e * 10 + (*q - '0');
+			exponent += negativeExp ? -e : e;
+			p = q;
+		}
+	}
+
+	if(exponent != 0) mantissa *= pow(10.0, exponent);
+	*value = negative ? -mantissa : mantissa;
+	return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::LoadMission(int num)
+{
+	char path[DEFAULT_STRING];
+	sprintf(path, MissionDataPathFormat.c_str(), MissionFiles[num].c_str());
+
+	QFile* file = RepositoryManager::GetInstance()->TryOpen(path);
+	if(!file)
+	{
+		Console::Error(QString("Opening navigation file %1 failed.").arg(path));
+		return;
+	}
+
+	myTimestamps.clear();
+	myX.clear();
+	myY.clear();
+	myDepth.clear();
+	myImageNameOffsets.clear();
+	myLogOffsets.clear();
+	// Offset 0 is the empty string, used for records without a log message.
+	myStringPool = QByteArray(1, '\0');
+
+	qint64 size = file->size();
+	const char* data = (const char*)file->map(0, size);
+	if(data == NULL && size > 0)
+	{
+		Console::Error(QString("Mapping navigation file %1 failed.").arg(path));
+	}
+	else
+	{
+		// Reserve using a rough estimate of the record length, the columns are trimmed once parsed.
+		int estimate = (int)(size / 48);
+		myTimestamps.reserve(estimate);
+		myX.reserve(estimate);
+		myY.reserve(estimate);
+		myDepth.reserve(estimate);
+		myImageNameOffsets.reserve(estimate);
+		myLogOffsets.reserve(estimate);
+
+		const char* end = data + size;
+		// Skip the first line, which is a header.
+		const char* line = data != NULL ? (const char*)memchr(data, '\n', size) : NULL;
+		while(line != NULL && ++line < end)
+		{
+			const char* lineEnd = (const char*)memchr(line, '\n', end - line);
+			if(lineEnd == NULL) lineEnd = end;
+
+			//%Timestamp X Y Depth ImageName Log
+			double values[4];
+			const char* p = line;
+			for(int i = 0; i < 4 && p != NULL; i++) p = ParseNumber(p, lineEnd, &values[i]);
+			if(p != NULL)
+			{
+				myTimestamps.append((int)values[0]);
+				myX.append(values[1]);
+				myY.append(values[2]);
+				myDepth.append(values[3]);
+
+				// Image name. Records without an image use '#'.
+				while(p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+				const char* token = p;
+				while(p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r') p++;
+				myImageNameOffsets.append(myStringPool.size());
+				if(p > token) myStringPool.append(QByteArray(token, p - token));
+				else myStringPool.append('#');
+				myStringPool.append('\0');
+
+				// The rest of the line is an optional log message.
+				while(p < lineEnd && (*p == ' ' || *p == '\t')) p++;
+				const char* logEnd = lineEnd;
+				while(logEnd > p && (logEnd[-1] == '\r' || logEnd[-1] == ' ' || logEnd[-1] == '\t')) logEnd--;
+				if(logEnd > p)
+				{
+					myLogOffsets.append(myStringPool.size());
+					myStringPool.append(QByteArray(p, logEnd - p));
+					myStringPool.append('\0');
+				}
+				else
+				{
+					myLogOffsets.append(0);
+				}
+			}
+			line = lineEnd < end ? lineEnd : NULL;
+		}
+		file->unmap((uchar*)data);
+	}
+
+	// close and free up file.
+	file->close();
+	delete file;
+	file = NULL;
+
+	myTimestamps.squeeze();
+	myX.squeeze();
+	myY.squeeze();
+	myDepth.squeeze();
+	myImageNameOffsets.squeeze();
+	myLogOffsets.squeeze();
+	myStringPool.squeeze();
+	myNavigationViewDataLength = myTimestamps.size();
+
+	Console::Message(QString("Mission data length: %1").arg(myNavigationViewDataLength));
+
+	UpdateMissionPath();
+
+	myMissionPathMapper->SetInput(myMissionPathData);
+	myMissionPathMapper->Update();
+
+	myMissionPathActor->SetMapper(myMissionPathMapper);
+	myMissionPathActor->SetPosition(0, PathDepthOffset * myDepthScale, 0);
+	myMissionPathActor->SetScale(1, myDepthScale, 1);
+	myMissionPathActor->GetProperty()->SetLineWidth(1);
+	myMissionPathActor->GetProperty()->SetRepresentationToPoints();
+
+	myVizMng->GetMainRenderer()->AddActor(myMissionPathActor);
+	myVizMng->Render();
+
+	myPlayIndex = 0;
+	myLogIndex = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::UpdateMissionPath()
+{
+	// One path point every PathDecimation records, each connected to the next one by a line cell.
+	// Point coordinates and cell connectivity are written directly into the VTK arrays.
+	int numPts = (myNavigationViewDataLength + PathDecimation - 1) / PathDecimation;
+	int numLines = qMax(numPts - 1, 0);
+
+	vtkFloatArray* coords = vtkFloatArray::New();
+	coords->SetNumberOfComponents(3);
+	float* pt = coords->WritePointer(0, numPts * 3);
+	for(int i = 0; i < myNavigationViewDataLength; i += PathDecimation)
+	{
+		*pt++ = myX[i];
+		*pt++ = -myDepth[i];
+		*pt++ = myY[i];
+	}
+
+	vtkIdTypeArray* connectivity = vtkIdTypeArray::New();
+	vtkIdType* cell = connectivity->WritePointer(0, numLines * 3);
+	for(int i = 0; i < numLines; i++)
+	{
+		*cell++ = 2;
+		*cell++ = i;
+		*cell++ = i + 1;
+	}
+
+	vtkPoints* pts = vtkPoints::New();
+	pts->SetData(coords);
+	vtkCellArray* cells = vtkCellArray::New();
+	cells->SetCells(numLines, connectivity);
+
+	myMissionPathData->Initialize();
+	myMissionPathData->SetPoints(pts);
+	myMissionPathData->SetLines(cells);
+
+	connectivity->Delete();
+	coords->Delete();
+	cells->Delete();
+	pts->Delete();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::SetupUI()
+{
+	myUI = new Ui::NavigationViewDock();
+	myUI->setupUi(GetDockWidget());
+
+	myTimer = new QTimer();
+
+	myUI->imgDistanceSlider->setValue(50);
+	OnImgDistanceSliderValueChanged(50);
+
+	// Wire events.
+	connect(myUI->timeSlider, SIGNAL(sliderMoved(int)),
+		SLOT(OnTimeSliderValueChanged(int)));
+
+	connect(myUI->imgDistanceSlider, SIGNAL(sliderMoved(int)),
+		SLOT(OnImgDistanceSliderValueChanged(int)));
+
+	connect(myTimer, SIGNAL(timeout()),
+		SLOT(OnTimerTick()));
+
+	connect(myUI->diveBox, SIGNAL(currentIndexChanged(int)),
+		SLOT(OnDiveBoxChanged(int)));
+
+	connect(myUI->timeBackButton, SIGNAL(clicked()), 
+		SLOT(OnTimeBackButtonClick()));
+
+	connect(myUI->timeForwardButton, SIGNAL(clicked()), 
+		SLOT(OnTimeForwardButtonClick()));
+
+	connect(myUI->showMissionButton, SIGNAL(toggled(bool)), 
+		SLOT(OnShowMissionButtonToggle(bool)));
+
+	connect(myUI->imgEnabledButton, SIGNAL(toggled(bool)), 
+		SLOT(OnImgEnabledButtonButtonToggle(bool)));
+
+	connect(myUI->playButton, SIGNAL(toggled(bool)), 
+		SLOT(OnPlayButtonToggle(bool)));
+
+	connect(myUI->exportImageButton, SIGNAL(clicked()), 
+		SLOT(OnExportImageButtonClick()));
+
+	connect(myUI->imgUpdateButton, SIGNAL(clicked()), 
+		SLOT(OnImgUpdateButtonClick()));
+
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::Update()
+{
+	if(myPlayIndex >= myNavigationViewDataLength) return;
+
+	time_t time = myTimestamps[myPlayIndex];
+	tm* ptm = gmtime(&time);
+
+	myUI->timeLabel->setText(asctime(ptm));
+
+	myAUVActor->SetPosition(myX[myPlayIndex], (-myDepth[myPlayIndex] + PathDepthOffset) * myDepthScale , myY[myPlayIndex]);
+	myAUVActor->SetScale(6, 6, 6);
+	myAUVActor->GetProperty()->SetLighting(0);
+	myAUVActor->GetProperty()->SetColor(0, 1, 1);
+	myAUVActor->GetProperty()->BackfaceCullingOff();
+	myAUVActor->GetProperty()->FrontfaceCullingOff();
+	myVizMng->Render();
+
+	// Print log message.
+	if(myPlayIndex > myLogIndex)
+	{
+		for(int i = myLogIndex; i < myPlayIndex; i++)
+		{
+			if(strlen(GetLog(i)) > 2)
+			{
+				time_t ltime = myTimestamps[i];
+				tm* lptm = gmtime(&ltime);
+				myUI->logView->addItem(QString("%1:%2:%3 - %4")
+					.arg(lptm->tm_hour).arg(lptm->tm_min).arg(lptm->tm_sec).arg(GetLog(i)));
+			}
+			myVizMng->SetStatusbarMessage(QString("X: %1    Y: %2   Depth: %3")
+				.arg(myX[i])
+				.arg(myY[i])
+				.arg(myDepth[i]));
+		}
+	}
+	myUI->logView->scrollToBottom();
+	myLogIndex = myPlayIndex;
+
+	// Update camera images.
+	if(GetImageName(myPlayIndex)[0] != '#')
+	{
+		QString path;
+		path.sprintf(ImagePathFormat.c_str(), GetImageName(myPlayIndex));
+		myUpImage.load(path);
+		myUI->upView->setPixmap(myUpImage);
+	}
+	else
+	{
+		// Hack - to avoid sparse empty images - this problem should actually
+		// be solved inside the preprocessing tool.
+		if(myPlayIndex + 1 >= myNavigationViewDataLength || GetImageName(myPlayIndex + 1)[0] == '#')
+		{
+			myUI->upView->clear();
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::UpdateImageOverlays()
+{
+	myOverlayStartIndex = 0;
+	
+	for(int i = 0; i < MAX_IMAGE_OVERLAYS; i++)
+	{
+		vtkRenderer* renderer = myVizMng->GetMainRenderer();
+		myOverlays[i]->SetVisible(false);
+	}
+
+	int lastIndex = 0;
+	int overlayIndex = 0;
+	// STEP 1: Always add images closer to the ice surface.
+	//for(int i = myOverlayStartIndex; i < myNavigationViewDataLength; i++)
+	//{
+	//	// if this data point has no associated image, skip it.
+	//	if(myNavigationViewData[i].UPImageName[0] != '#')
+	//	{
+	//		if(myNavigationViewData[i].Depth < IcePickingThreshold)
+	//		{
+	//			// Check to see if image is not too close to other already added overlays
+	//			bool ok = true;
+	//			for(int j = 0; j < overlayIndex; j++)
+	//			{
+	//				float dx2 = myNavigationViewData[i].X - myOverlays[j]->X;
+	//				float dy2 = myNavigationViewData[i].Y - myOverlays[j]->Y;
+	//				float d2 = sqrt(dx2 * dx2 + dy2 * dy2);
+	//				if(d2 < 30)
+	//				{
+	//					ok = false;
+	//					break;
+	//				}
+	//			}
+	//			if(ok)
+	//			{
+	//				// If distance check is ok, create a new image overlay from this data point.
+	//				myOverlays[overlayIndex]->Index = i;
+	//				myOverlays[overlayIndex]->SetTexture(ImagePathFormat.c_str(), myNavigationViewData[i].UPImageName);
+	//				myOverlays[overlayIndex]->SetPosition(myNavigationViewData[i].X, myNavigationViewData[i].Y);
+	//				// Scale image overlay depending on overlay distance.
+	//				myOverlays[overlayIndex]->SetSize(myOverlayDistance / 1.5f);
+	//				myOverlays[overlayIndex]->SetVisible(true);
+	//				overlayIndex++;
+	//				lastIndex = i;
+	//			}
+	//		}
+	//	}
+	//}
+
+	for(int i = myOverlayStartIndex; i < myNavigationViewDataLength && overlayIndex < MAX_IMAGE_OVERLAYS; i++)
+	{
+		// if this data point has no associated image, skip it.
+		if(GetImageName(i)[0] != '#')
+		{
+			// Check to see if image is not too close to other already added overlays
+			bool ok = true;
+			for(int j = 0; j < overlayIndex; j++)
+			{
+				float dx2 = myX[i] - myOverlays[j]->X;
+				float dy2 = myY[i] - myOverlays[j]->Y;
+				float d2 = sqrt(dx2 * dx2 + dy2 * dy2);
+				if(d2 < myOverlayDistance)
+				{
+					ok = false;
+					break;
+				}
+			}
+			if(ok)
+			{
+				// If distance check is ok, create a new image overlay from this data point.
+				myOverlays[overlayIndex]->Index = i;
+				myOverlays[overlayIndex]->SetTexture(ImagePathFormat.c_str(), GetImageName(i));
+				myOverlays[overlayIndex]->SetPosition(myX[i], myY[i]);
+				// Scale image overlay depending on overlay distance.
+				myOverlays[overlayIndex]->SetSize(myOverlayDistance / 1.5f);
+				myOverlays[overlayIndex]->SetVisible(true);
+				overlayIndex++;
+				lastIndex = i;
+			}
+		}
+	}
+	myActiveOverlays = overlayIndex;
+	myUI->imgEnabledButton->setChecked(true);
+	myVizMng->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::SetMissionPathColor(QColor value)
+{
+	myMissionPathColor = value;
+	myMissionPathActor->GetProperty()->SetColor(QCOLOR_TO_VTK(myMissionPathColor));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnShowMissionButtonToggle(bool value)
+{
+	myAUVActor->SetVisibility(value);
+	myMissionPathActor->SetVisibility(value);
+	if(value)
+	{
+		OnTimeSliderValueChanged(myUI->timeSlider->value());
+	}
+	myVizMng->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnTimeSliderValueChanged(int value)
+{
+	myPlayIndex = myNavigationViewDataLength * value / myUI->timeSlider->maximum();
+	Update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnDiveBoxChanged(int value)
+{
+	LoadMission(value);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnTimerTick()
+{
+	myPlayIndex++;
+	if(myPlayIndex == myNavigationViewDataLength)
+	{
+		myTimer->stop();
+		myUI->playButton->setChecked(false);
+	}
+	else
+	{
+		Update();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnPlayButtonToggle(bool value)
+{
+	if(value)
+	{
+		myTimer->start(200, false);
+	}
+	else
+	{
+		myTimer->stop();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnTimeForwardButtonClick()
+{
+	if(myPlayIndex < myNavigationViewDataLength - 1)
+	{
+		myPlayIndex++;
+		Update();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnTimeBackButtonClick()
+{
+	if(myPlayIndex > 0)
+	{
+		myPlayIndex--;
+		Update();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnExportImageButtonClick()
+{
+	for(int i = 0; i < myActiveOverlays; i++)
+	{
+		int idx = myOverlays[i]->Index;
+		QString path;
+		path.sprintf(ImagePathFormat.c_str(), GetImageName(idx));
+		QFile* source = new QFile(path);
+		path.sprintf(ImageExportPathFormat.c_str(), 
+			myTimestamps[idx],
+			(int)myX[idx],
+			(int)myY[idx],
+			myDepth[idx]);
+		source->copy(path);
+		delete source;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnImgUpdateButtonClick()
+{
+	UpdateImageOverlays();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnImgDistanceSliderValueChanged(int value)
+{
+	myOverlayDistance = value;
+	myUI->imgDistanceLabel->setText(QString("Image Distance: %1 meters").arg(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NavigationView::OnImgEnabledButtonButtonToggle(bool value)
+{
+	for(int i = 0; i < myActiveOverlays; i++)
+	{
+		myOverlays[i]->SetVisible(value);
+	}
+	myVizMng->Render();
 }
\ No newline at end of file
@@ -0,0 +1,453 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "AppConfig.h"
+#include "ParallelCoordinatesView.h"
+#include "DensityBinner.h"
+#include "Preferences.h"
+#include "VisualizationManager.h"
+
+#include <vtkActor2D.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkCoordinate.h>
+#include <vtkInteractorStyleRubberband2D.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper2D.h>
+#include <vtkProperty2D.h>
+#include <vtkRenderer.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkTextActor.h>
+#include <vtkTextProperty.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <math.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+VTK_CALLBACK(PCSelectionChangedCallback, ParallelCoordinatesView, OnSelectionChanged(reinterpret_cast<int*>(data)));
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+const float ParallelCoordinatesView::MARGIN_X = 0.06f;
+const float ParallelCoordinatesView::MARGIN_TOP = 0.1f;
+const float ParallelCoordinatesView::MARGIN_BOTTOM = 0.04f;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ParallelCoordinatesView::ParallelCoordinatesView(VisualizationManager* mng): 
+	DockedTool(mng, "Parallel Coordinates", Qt::BottomDockWidgetArea),
+	myVizMng(mng),
+	myBins(0)
+{
+	GetMenuAction()->setIcon(QIcon(":/icons/PlotView.png"));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ParallelCoordinatesView::~ParallelCoordinatesView()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	for(int i = 0; i < myFilters.size(); i++)
+	{
+		data->RemoveFilter(myFilters[i]);
+		delete myFilters[i];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::Initialize()
+{
+	DataSet* data = myVizMng->GetDataSet();
+
+	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
+	{
+		DynamicFilter* filter = new DynamicFilter();
+		filter->Type = DynamicFilter::FieldFilter;
+		filter->Enabled = false;
+		filter->FieldId = i;
+		data->AddFilter(filter);
+		myFilters.append(filter);
+	}
+
+	data->AddListener(this, DataSet::FilteredChanged | DataSet::FieldValuesChanged | DataSet::FieldRangeChanged | 
+		DataSet::FieldsEnabledChanged);
+
+	SetupUI();
+
+	// Setup VTK stuff.
+	myRenderer = vtkRenderer::New();
+
+	myLineData = vtkPolyData::New();
+	myLineActor = NewActor2D(myLineData);
+	myAxisData = vtkPolyData::New();
+	myAxisActor = NewActor2D(myAxisData);
+	myRangeData = vtkPolyData::New();
+	myRangeActor = NewActor2D(myRangeData);
+	myRangeActor->GetProperty()->SetLineWidth(4);
+
+	myRenderWindow = myUI->vtkView->GetRenderWindow();
+	myRenderWindow->AddRenderer(myRenderer);
+	myInteractorStyle = vtkInteractorStyleRubberBand2D::New();
+	myInteractorStyle->AddObserver("SelectionChangedEvent", new PCSelectionChangedCallback(this));
+	myRenderWindow->GetInteractor()->SetInteractorStyle(myInteractorStyle);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::SetupUI()
+{
+	myUI = new Ui_ParallelCoordinatesDock();
+	myUI->setupUi(GetDockWidget());
+
+	connect(myUI->binsBox, SIGNAL(valueChanged(int)), SLOT(OnBinsChanged()));
+	connect(myUI->clearFiltersButton, SIGNAL(clicked()), SLOT(OnClearFiltersButtonClicked()));
+	connect(GetDockWidget(), SIGNAL(visibilityChanged(bool)), SLOT(OnVisibilityChanged(bool)));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+vtkActor2D* ParallelCoordinatesView::NewActor2D(vtkPolyData* data)
+{
+	// All the view geometry is expressed in normalized viewport coordinates.
+	vtkCoordinate* coordinate = vtkCoordinate::New();
+	coordinate->SetCoordinateSystemToNormalizedViewport();
+
+	vtkPolyDataMapper2D* mapper = vtkPolyDataMapper2D::New();
+	mapper->SetInput(data);
+	mapper->SetTransformCoordinate(coordinate);
+	mapper->ScalarVisibilityOn();
+	mapper->SetScalarModeToUseCellData();
+	coordinate->Delete();
+
+	vtkActor2D* actor = vtkActor2D::New();
+	actor->SetMapper(mapper);
+	mapper->Delete();
+	myRenderer->AddActor2D(actor);
+	return actor;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float ParallelCoordinatesView::GetAxisX(int axis)
+{
+	int numAxes = myFields.size();
+	if(numAxes < 2) return 0.5f;
+	return MARGIN_X + (1.0f - 2 * MARGIN_X) * axis / (numAxes - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float ParallelCoordinatesView::GetBinY(float bin)
+{
+	return MARGIN_BOTTOM + (1.0f - MARGIN_TOP - MARGIN_BOTTOM) * bin / myBins;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::Update()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	DataSetInfo* info = data->GetInfo();
+
+	// Axis ranges of disabled fields are not drawn anymore: stop filtering them.
+	bool filtersChanged = false;
+	myFields.clear();
+	for(int i = 0; i < info->GetNumFields(); i++)
+	{
+		if(info->GetField(i)->IsEnabled())
+		{
+			myFields.append(i);
+		}
+		else if(myFilters[i]->Enabled)
+		{
+			myFilters[i]->Enabled = false;
+			filtersChanged = true;
+		}
+	}
+	if(filtersChanged) data->ApplyFilters();
+
+	int numAxes = myFields.size();
+	myBins = myUI->binsBox->value();
+
+	// Bin the adjacent axis pairs over the filtered rows. Axes use the full field ranges, so that filtering 
+	// does not move the lines.
+	QVector<const float*> columns(numAxes);
+	myRanges.resize(numAxes * 2);
+	for(int i = 0; i < numAxes; i++)
+	{
+		float* range = data->GetFieldRange(myFields[i]);
+		columns[i] = data->GetFieldColumn(myFields[i]);
+		myRanges[i * 2] = range[0];
+		myRanges[i * 2 + 1] = range[1];
+	}
+	myCounts.resize(qMax(0, numAxes - 1) * myBins * myBins);
+	if(numAxes > 1) DensityBinner::BinAdjacentPairs(columns.data(), numAxes, data->GetMaskBuffer(), 
+		DataSet::MaskFiltered, data->GetDataLength(DataSet::AllData), myRanges.data(), myBins, myCounts.data());
+
+	UpdateLines();
+	UpdateAxes();
+	Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::UpdateLines()
+{
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+	int pairBins = myBins * myBins;
+	int numCounts = myCounts.size();
+	const unsigned int* counts = myCounts.constData();
+
+	unsigned int maxCount = 0;
+	int numLines = 0;
+	for(int i = 0; i < numCounts; i++)
+	{
+		if(counts[i] > maxCount) maxCount = counts[i];
+		if(counts[i] > 0) numLines++;
+	}
+	double scale = maxCount > 0 ? 255.0 / log(1.0 + maxCount) : 0;
+
+	// Lines are sorted by density with a counting sort on their color index, so that denser lines are 
+	// drawn on top.
+	QVector<int> levels(numCounts);
+	QVector<int> levelStart(257, 0);
+	for(int i = 0; i < numCounts; i++)
+	{
+		int t = 0;
+		if(counts[i] > 0)
+		{
+			t = (int)(log(1.0 + counts[i]) * scale);
+			if(t > 255) t = 255;
+			levelStart[t + 1]++;
+		}
+		levels[i] = t;
+	}
+	for(int t = 1; t <= 256; t++) levelStart[t] += levelStart[t - 1];
+	QVector<int> order(numLines);
+	for(int i = 0; i < numCounts; i++)
+	{
+		if(counts[i] > 0) order[levelStart[levels[i]]++] = i;
+	}
+
+	double table[256 * 3];
+	prefs->GetPlotColorTransferFunction()->GetTable(0.0, 1.0, 256, table);
+
+	vtkPoints* points = vtkPoints::New();
+	points->SetNumberOfPoints(numLines * 2);
+	vtkCellArray* lines = vtkCellArray::New();
+	lines->Allocate(numLines * 3);
+	vtkUnsignedCharArray* colors = vtkUnsignedCharArray::New();
+	colors->SetNumberOfComponents(4);
+	colors->SetNumberOfTuples(numLines);
+	for(int i = 0; i < numLines; i++)
+	{
+		// Histogram bins are stored by pair, then in row order with x along the left axis.
+		int index = order[i];
+		int pair = index / pairBins;
+		int bin = index % pairBins;
+		float x1 = GetAxisX(pair);
+		float x2 = GetAxisX(pair + 1);
+		points->SetPoint(i * 2, x1, GetBinY(bin % myBins + 0.5f), 0);
+		points->SetPoint(i * 2 + 1, x2, GetBinY(bin / myBins + 0.5f), 0);
+		vtkIdType ids[2] = { i * 2, i * 2 + 1 };
+		lines->InsertNextCell(2, ids);
+
+		int t = levels[index];
+		unsigned char* color = colors->GetPointer(i * 4);
+		color[0] = (unsigned char)(table[t * 3] * 255);
+		color[1] = (unsigned char)(table[t * 3 + 1] * 255);
+		color[2] = (unsigned char)(table[t * 3 + 2] * 255);
+		color[3] = (unsigned char)(64 + t * 191 / 255);
+	}
+
+	myLineData->Initialize();
+	myLineData->SetPoints(points);
+	myLineData->SetLines(lines);
+	myLineData->GetCellData()->SetScalars(colors);
+	points->Delete();
+	lines->Delete();
+	colors->Delete();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::UpdateAxes()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+	int numAxes = myFields.size();
+
+	myRenderer->SetBackground(QCOLOR_TO_VTK(prefs->GetPlotBackgroundColor()));
+	QColor foreground = prefs->GetPlotForegroundColor();
+	QColor highlight = prefs->GetPlotDefaultDataColor();
+
+	// Axis lines, and filtered ranges drawn over them.
+	vtkPoints* axisPoints = vtkPoints::New();
+	vtkCellArray* axisLines = vtkCellArray::New();
+	vtkUnsignedCharArray* axisColors = vtkUnsignedCharArray::New();
+	axisColors->SetNumberOfComponents(4);
+	vtkPoints* rangePoints = vtkPoints::New();
+	vtkCellArray* rangeLines = vtkCellArray::New();
+	vtkUnsignedCharArray* rangeColors = vtkUnsignedCharArray::New();
+	rangeColors->SetNumberOfComponents(4);
+	for(int i = 0; i < numAxes; i++)
+	{
+		float x = GetAxisX(i);
+		vtkIdType ids[2];
+		ids[0] = axisPoints->InsertNextPoint(x, GetBinY(0), 0);
+		ids[1] = axisPoints->InsertNextPoint(x, GetBinY(myBins), 0);
+		axisLines->InsertNextCell(2, ids);
+		axisColors->InsertNextTuple4(foreground.red(), foreground.green(), foreground.blue(), 255);
+
+		DynamicFilter* filter = myFilters[myFields[i]];
+		double min = myRanges[i * 2];
+		double extent = myRanges[i * 2 + 1] - min;
+		if(filter->Enabled && extent > 0)
+		{
+			float y1 = GetBinY(qBound(0.0, (filter->Min - min) / extent, 1.0) * myBins);
+			float y2 = GetBinY(qBound(0.0, (filter->Max - min) / extent, 1.0) * myBins);
+			ids[0] = rangePoints->InsertNextPoint(x, y1, 0);
+			ids[1] = rangePoints->InsertNextPoint(x, y2, 0);
+			rangeLines->InsertNextCell(2, ids);
+			rangeColors->InsertNextTuple4(highlight.red(), highlight.green(), highlight.blue(), 255);
+		}
+	}
+	myAxisData->Initialize();
+	myAxisData->SetPoints(axisPoints);
+	myAxisData->SetLines(axisLines);
+	myAxisData->GetCellData()->SetScalars(axisColors);
+	myRangeData->Initialize();
+	myRangeData->SetPoints(rangePoints);
+	myRangeData->SetLines(rangeLines);
+	myRangeData->GetCellData()->SetScalars(rangeColors);
+	axisPoints->Delete();
+	axisLines->Delete();
+	axisColors->Delete();
+	rangePoints->Delete();
+	rangeLines->Delete();
+	rangeColors->Delete();
+
+	// Field labels.
+	while(myLabels.size() < numAxes)
+	{
+		vtkTextActor* label = vtkTextActor::New();
+		label->GetPositionCoordinate()->SetCoordinateSystemToNormalizedViewport();
+		label->GetTextProperty()->SetJustificationToCentered();
+		label->GetTextProperty()->ShadowOff();
+		myRenderer->AddActor2D(label);
+		myLabels.append(label);
+	}
+	while(myLabels.size() > numAxes)
+	{
+		vtkTextActor* label = myLabels.takeLast();
+		myRenderer->RemoveActor2D(label);
+		label->Delete();
+	}
+	for(int i = 0; i < numAxes; i++)
+	{
+		vtkTextActor* label = myLabels[i];
+		label->SetInput(data->GetFieldName(myFields[i]).ascii());
+		label->GetPositionCoordinate()->SetValue(GetAxisX(i), 1.0f - MARGIN_TOP * 0.7f);
+		label->GetTextProperty()->SetColor(QCOLOR_TO_VTK(foreground));
+		label->GetTextProperty()->SetFontSize(prefs->GetPlotLabelFontSize());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::Render()
+{
+	myRenderWindow->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::OnSelectionChanged(int* sel)
+{
+	DataSet* data = myVizMng->GetDataSet();
+	int* size = myRenderWindow->GetSize();
+	float x1 = (float)qMin(sel[0], sel[2]) / size[0];
+	float x2 = (float)qMax(sel[0], sel[2]) / size[0];
+	float y1 = (float)qMin(sel[1], sel[3]) / size[1];
+	float y2 = (float)qMax(sel[1], sel[3]) / size[1];
+
+	if(sel[0] == sel[2] && sel[1] == sel[3])
+	{
+		// If action was just a click, clear the filters.
+		OnClearFiltersButtonClicked();
+		return;
+	}
+
+	// Filter the range of each axis crossed by the selection box. Filters are evaluated on the dataset field
+	// columns by DataSet::ApplyFilters.
+	bool changed = false;
+	float height = 1.0f - MARGIN_TOP - MARGIN_BOTTOM;
+	for(int i = 0; i < myFields.size(); i++)
+	{
+		float x = GetAxisX(i);
+		if(x < x1 || x > x2) continue;
+
+		double min = myRanges[i * 2];
+		double extent = myRanges[i * 2 + 1] - min;
+		DynamicFilter* filter = myFilters[myFields[i]];
+		filter->Enabled = true;
+		filter->Min = (float)(min + qBound(0.0f, (y1 - MARGIN_BOTTOM) / height, 1.0f) * extent);
+		filter->Max = (float)(min + qBound(0.0f, (y2 - MARGIN_BOTTOM) / height, 1.0f) * extent);
+		changed = true;
+	}
+	if(changed) data->ApplyFilters();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::OnDataSetChanged(DataSet::ChangeType change, int field)
+{
+	if(!IsEnabled()) return;
+	if(change != DataSet::FilteredChanged && change != DataSet::FieldsEnabledChanged && !myFields.contains(field)) return;
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::OnBinsChanged()
+{
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::OnClearFiltersButtonClicked()
+{
+	bool changed = false;
+	for(int i = 0; i < myFilters.size(); i++)
+	{
+		if(myFilters[i]->Enabled)
+		{
+			myFilters[i]->Enabled = false;
+			changed = true;
+		}
+	}
+	if(changed) myVizMng->GetDataSet()->ApplyFilters();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParallelCoordinatesView::OnVisibilityChanged(bool visible)
+{
+	// The view is not kept up to date while hidden.
+	if(visible) myVizMng->RequestUpdate(this);
+}
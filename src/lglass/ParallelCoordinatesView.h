@@ -0,0 +1,110 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef PARALLELCOORDINATESVIEW_H
+#define PARALLELCOORDINATESVIEW_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+#include "DockedTool.h"
+#include "ui_ParallelCoordinatesDock.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class vtkActor2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Parallel coordinates over all the enabled fields. Instead of one polyline per row, the view draws the
+// line density between adjacent axes: rows are binned into one histogram per axis pair, and each non
+// empty bin pair becomes a single line colored by its count. Drawing cost only depends on the number of 
+// bins. Dragging across axes sets field filters on their ranges.
+class ParallelCoordinatesView: public DockedTool, public DataSetListener
+{
+	Q_OBJECT
+public:
+	// Plot area margins, in normalized viewport coordinates.
+	static const float MARGIN_X;
+	static const float MARGIN_TOP;
+	static const float MARGIN_BOTTOM;
+
+public:
+    /////////////////////////////////////////////////////// Ctor / Dtor.
+    ParallelCoordinatesView(VisualizationManager* mng);
+    ~ParallelCoordinatesView();
+
+    /////////////////////////////////////////////////////// Other Methods.
+    void Initialize();
+    void Update();
+	void Render();
+	void OnSelectionChanged(int* sel);
+	// The view depends on the filtered data and on the values and ranges of the shown fields.
+	void OnDataSetChanged(DataSet::ChangeType change, int field);
+
+protected slots:
+	void OnBinsChanged();
+	void OnClearFiltersButtonClicked();
+	void OnVisibilityChanged(bool visible);
+
+private:
+	void SetupUI();
+	vtkActor2D* NewActor2D(vtkPolyData* data);
+	void UpdateLines();
+	void UpdateAxes();
+	float GetAxisX(int axis);
+	float GetBinY(float bin);
+
+private:
+	// UI.
+	Ui_ParallelCoordinatesDock* myUI;
+	VisualizationManager* myVizMng;
+
+	// VTK stuff.
+	vtkRenderWindow* myRenderWindow;
+	vtkRenderer* myRenderer;
+	vtkInteractorStyleRubberBand2D* myInteractorStyle;
+	vtkPolyData* myLineData;
+	vtkActor2D* myLineActor;
+	vtkPolyData* myAxisData;
+	vtkActor2D* myAxisActor;
+	vtkPolyData* myRangeData;
+	vtkActor2D* myRangeActor;
+	QList<vtkTextActor*> myLabels;
+
+	// Shown fields and their adjacent pair histograms, as returned by DensityBinner::BinAdjacentPairs.
+	QVector<int> myFields;
+	QVector<double> myRanges;
+	QVector<unsigned int> myCounts;
+	int myBins;
+
+	// One range filter for each dataset field.
+	QVector<DynamicFilter*> myFilters;
+};
+
+#endif
@@ -1,625 +1,1161 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "AppConfig.h"
-#include "Preferences.h"
-#include "PlotView.h"
-#include "DataSet.h"
-#include "GeoDataView.h"
-#include "Plot.h"
-#include "Utils.h"
-#include "VisualizationManager.h"
-#include "ui_MainWindow.h"
-#include "VtkDataManager.h"
-
-#include "vtkAxisActor2D.h"
-#include "vtkLegendBoxActor.h"
-
-#include <QmessageBox>
-
-#include <vtkAttributeDataToFieldDataFilter.h>
-#include <vtkColorTransferFunction.h>
-#include <vtkFieldData.h>
-#include <vtkFloatArray.h>
-#include <vtkInteractorStyleRubberband2D.h>
-#include <vtkPointData.h>
-#include <vtkPointSet.h>
-#include <vtkProperty2D.h>
-#include <vtkRenderer.h>
-#include <vtkRenderWindow.h>
-#include <vtkTextProperty.h>
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-VTK_CALLBACK(SelectionChangedCallback, PlotView, OnSelectionChanged(reinterpret_cast<int*>(data)));
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-DynamicFilter* PlotView::myXFilter = NULL;
-DynamicFilter* PlotView::myYFilter = NULL;
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-PlotView::PlotView(VisualizationManager* mng, int index): 
-	DockedTool(mng, QString("Plot Window %1").arg(index), Qt::RightDockWidgetArea)
-{
-	myVizMng = mng;
-	GetMenuAction()->setIcon(QIcon(":/icons/PlotView.png"));
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-PlotView::~PlotView()
-{
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::Initialize()
-{
-	VisualizationManager* mng = myVizMng;
-
-	if(!myXFilter)
-	{
-		myXFilter = new DynamicFilter();
-		myYFilter = new DynamicFilter();
-
-		myXFilter->Type = DynamicFilter::FieldFilter;
-		myYFilter->Type = DynamicFilter::FieldFilter;
-		
-		myXFilter->Enabled = false;
-		myYFilter->Enabled = false;
-
-		myVizMng->GetDataSet()->AddFilter(myXFilter);
-		myVizMng->GetDataSet()->AddFilter(myYFilter);
-	}
-
-	SetupUI();
-
-	// Setup VTK stuff.
-    myPlot = Plot::New();
-    myPlot->GetPositionCoordinate()->SetCoordinateSystemToNormalizedViewport();
-    myPlot->GetPositionCoordinate()->SetValue(0.0f, 0.0f);
-    myPlot->SetPlotPoints(0);
-    myPlot->SetWidth(1.0f);
-    myPlot->SetHeight(1.0f);
-
-    myPlotRenderer = vtkRenderer::New();
-    myPlotRenderer->AddActor2D(myPlot);
-	
-	myPlotRenderWindow = myUI->vtkView->GetRenderWindow();
-	myInteractorStyle = vtkInteractorStyleRubberBand2D::New();
-	myInteractorStyle->AddObserver("SelectionChangedEvent", new SelectionChangedCallback(this));
-	myPlotRenderWindow->GetInteractor()->SetInteractorStyle(myInteractorStyle);
-
-    myPlotDataFilter = vtkAttributeDataToFieldDataFilter::New();
-
-	myUI->vtkView->GetRenderWindow()->AddRenderer(myPlotRenderer);
-
-	myVizMng->GetDataSet()->ApplyFilters();
-
-	SetPlotProperties();
-
-	//Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::SetupUI()
-{
-	DataSet* data = myVizMng->GetDataSet();
-
-	myUI = new Ui_PlotViewDock();
-	myUI->setupUi(GetDockWidget());
-	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
-    {
-        myUI->xAxisBox->addItem(data->GetFieldName(i), i);
-        myUI->yAxisBox->addItem(data->GetFieldName(i), i);
-    }
-	
-	myUI->xLegendPositionSlider->setValue(70);
-	myUI->yLegendPositionSlider->setValue(0);
-	myUI->plotXSlider->setValue(0);
-	myUI->plotWidthSlider->setValue(100);
-
-	//myUI->layoutBox->setVisible(false);
-	// Setup some default plot to show something.
-	myUI->xAxisBox->setCurrentIndex(0);
-	myUI->yAxisBox->setCurrentIndex(1);
-
-    connect(myUI->xAxisBox, SIGNAL(currentIndexChanged(int)), SLOT(OnAxisFieldChanged(int)));
-    connect(myUI->yAxisBox, SIGNAL(currentIndexChanged(int)), SLOT(OnAxisFieldChanged(int)));
-	connect(myUI->viewAllButton, SIGNAL(clicked()),	SLOT(OnViewAllButtonClicked()));
-	connect(myUI->exportImageButton, SIGNAL(clicked()),	SLOT(OnExportImageButtonClicked()));
-
-	connect(myUI->xRangeMinBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
-	connect(myUI->yRangeMinBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
-	connect(myUI->xRangeMaxBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
-	connect(myUI->yRangeMaxBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
-
-	connect(myUI->xMinorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
-	connect(myUI->xMajorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
-	connect(myUI->yMinorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
-	connect(myUI->yMajorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
-
-	connect(myUI->xReferenceEnabledBox, SIGNAL(toggled(bool)), SLOT(OnReferenceLinesChanged()));
-	connect(myUI->yReferenceEnabledBox, SIGNAL(toggled(bool)), SLOT(OnReferenceLinesChanged()));
-	connect(myUI->xReferenceBox, SIGNAL(valueChanged(double)), SLOT(OnReferenceLinesChanged()));
-	connect(myUI->yReferenceBox, SIGNAL(valueChanged(double)), SLOT(OnReferenceLinesChanged()));
-
-	connect(myUI->yLegendPositionSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
-	connect(myUI->xLegendPositionSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
-	connect(myUI->plotXSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
-	connect(myUI->plotWidthSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
-
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::SetPlotProperties()
-{
-	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
-
-	myPlotRenderer->SetBackground(QCOLOR_TO_VTK(prefs->GetPlotBackgroundColor()));
-
-	int labelFontSize = prefs->GetPlotLabelFontSize();
-
-	vtkTextProperty* textProp = NULL;
-
-	// Set plot parameters
-	myPlot->SetPlotColor(0, QCOLOR_TO_VTK(prefs->GetPlotDefaultDataColor()));
-	myPlot->GetXAxisActor2D()->GetProperty()->SetLineWidth(1);
-	myPlot->GetXAxisActor2D()->GetProperty()->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-	myPlot->GetYAxisActor2D()->GetProperty()->SetLineWidth(1);
-	myPlot->GetYAxisActor2D()->GetProperty()->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-
-	myPlot->GetXAxisActor2D()->SetLabelFactor((float)labelFontSize / 10.0f);
-	myPlot->GetYAxisActor2D()->SetLabelFactor((float)labelFontSize / 10.0f);
-	myPlot->GetTitleTextProperty()->SetFontSize(labelFontSize);
-	myPlot->GetTitleTextProperty()->SetFontFamilyToCourier();
-
-	myPlot->GetLegendActor()->SetDragable(0);
-	myPlot->SetLegend(prefs->GetPlotLegend() ? 1 : 0);
-
-	float plotX = (float)myUI->plotXSlider->value() / 100;
-	float plotWidth = (float)myUI->plotWidthSlider->value() / 100;
-    myPlot->SetWidth(plotWidth);
-	myPlot->SetPosition(plotX, 0);
-
-	if(prefs->GetPlotLegend())
-	{
-		DataSet* data = myVizMng->GetDataSet();
-		// Set legend size.
-		int nonEmptyGroups = 1;
-		int grps = data->GetNumGroups();
-		for(int i = 0; i < grps; i++)
-		{
-			DataGroup* grp = data->GetGroup(i);
-			if(grp->Size > 0) nonEmptyGroups++;
-		}
-
-		// Take into account enabled reference lines when sizing legend box.
-		if(myUI->xReferenceEnabledBox->isChecked()) nonEmptyGroups++;
-		if(myUI->yReferenceEnabledBox->isChecked()) nonEmptyGroups++;
-
-		int* size = myPlotRenderWindow->GetSize();
-		float yPos = (float)nonEmptyGroups * 20 / size[1];
-		if(yPos > 1) yPos = 1;
-
-		float xpp = (float)myUI->xLegendPositionSlider->value() / 100;
-		float ypp = (float)myUI->yLegendPositionSlider->value() / 100;
-		//xpp *= 1 / plotWidth;
-		//float xpp = 1;
-		//float ypp = 0;
-
-		myPlot->SetLegendPosition(xpp, 1 - yPos - ypp);
-		myPlot->SetLegendPosition2(0.3f, yPos);
-	}
-
-	// X axis labels
-	textProp = myPlot->GetXAxisActor2D()->GetLabelTextProperty();
-	textProp->ShadowOff();
-	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-	textProp->SetFontFamilyToCourier();
-	//textProp->SetFontSize(labelFontSize);
-
-	// X axis title
-	textProp = myPlot->GetXAxisActor2D()->GetTitleTextProperty();
-	textProp->ShadowOff();
-	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-	textProp->SetFontFamilyToCourier();
-
-	// Y axis labels
-	textProp = myPlot->GetYAxisActor2D()->GetLabelTextProperty();
-	textProp->ShadowOff();
-	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-	textProp->SetFontFamilyToCourier();
-
-	// Y axis title
-	textProp = myPlot->GetYAxisActor2D()->GetTitleTextProperty();
-	textProp->ShadowOff();
-	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-	textProp->SetFontFamilyToCourier();
-
-	myPlot->GetProperty()->SetLineWidth(2);
-
-	// Set axis labels properties.
-	//myPlot->SetAdjustXLabels(prefs->GetAdjustPlotLabels());
-	//myPlot->SetAdjustYLabels(prefs->GetAdjustPlotLabels());
-	
-	myPlot->SetAdjustXLabels(0);
-	myPlot->SetAdjustYLabels(0);
-
-	myPlot->SetNumberOfXLabels(myUI->xMajorTicksBox->value());
-	myPlot->SetNumberOfXMinorTicks(myUI->xMinorTicksBox->value());
-
-	myPlot->SetNumberOfYLabels(myUI->yMajorTicksBox->value());
-	myPlot->SetNumberOfYMinorTicks(myUI->yMinorTicksBox->value());
-
-	myPlotRenderWindow->Render();
-}
-
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::Update()
-{
-	VisualizationManager* mng = myVizMng;
-	DataSet* data = mng->GetDataSet();
-
-	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
-
-	int xField = myUI->xAxisBox->currentIndex();
-	int yField = myUI->yAxisBox->currentIndex();
-
-	SetPlotProperties();
-
-	myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontSize(5);
-	myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontFamilyToCourier();
-	myPlot->GetLegendActor()->GetEntryTextProperty()->Modified();
-
-	// If I use the same field on both coordinates, the XYPlotActor apparently gets stuck...
-	if(xField != yField)
-	{
-		vtkPointData* dataPoints = VtkDataManager::GetInstance()->GetPointSet(DataSet::FilteredData)->GetPointData();
-
-		vtkDataArray* xData = dataPoints->GetArray(data->GetFieldName(xField).ascii());
-		vtkDataArray* yData = dataPoints->GetArray(data->GetFieldName(yField).ascii());
-
-		vtkFieldData* fieldData = vtkFieldData::New();
-		fieldData->AddArray(xData);
-		fieldData->AddArray(yData);
-
-		vtkDataObject *dataObject = vtkDataObject::New();
-		dataObject->SetFieldData(fieldData);
-
-		myPlot->RemoveAllInputs();
-
-		myPlot->AddDataObjectInput(dataObject);
-
-		myPlot->PlotCurveLinesOn();
-		myPlot->SetPlotLines(0, 0);
-		myPlot->PlotPointsOn();
-		myPlot->SetXValuesToValue();
-		myPlot->SetDataObjectXComponent(0, 0);
-		myPlot->SetDataObjectYComponent(0, 1);
-
-		//myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontSize(10);
-
-		char title[256];
-		sprintf(title, "%s vs %s", data->GetFieldName(yField).ascii(), data->GetFieldName(xField).ascii());
-		myPlot->SetXTitle(title);
-		myPlot->SetYTitle("");
-
-		vtkPointData* selectedDataPoints = NULL;
-		vtkFieldData* selectedFieldData = NULL;
-		vtkDataObject *selectedDataObject = NULL;
-
-		int grps = data->GetNumSortedGroups();
-
-		//int nonEmptyGroups = grps;
-		/*for(int i = 0; i < grps; i++)
-		{
-			DataGroup* grp = data->GetGroup(i);
-			if(grp->Size > 0) nonEmptyGroups++;
-		}*/
-
-		// Check the plot limit.
-		if(grps > 500)
-		{
-			Console::Error("PLOT LIMIT REACHED: Cannot plot more than 500 curves.");
-			ShutdownApp(true, false);
-		}
-		if(grps > 100)
-		{
-			QMessageBox::StandardButton btn = QMessageBox::question(
-				NULL, 
-				"Plot View Warning", 
-				"The current plot parameters will generate more than 100 unique plot components. The operation may take a while. Do you want to proceed?", 
-				QMessageBox::Abort | QMessageBox::Ok);
-			if(btn == QMessageBox::Abort) return;
-		}
-
-		vtkColorTransferFunction* colorMap = prefs->GetPlotColorTransferFunction();		
-
-		//printf("total Groups: %d, nonEmpty: %d\n", grps, nonEmptyGroups);
-
-		//myPlot->GetLegendActor()->SetNumberOfEntries(nonEmptyGroups);
-
-		int c = 0;
-		if(myUI->xReferenceEnabledBox->isChecked())
-		{
-			float x1 = (float)myUI->xReferenceBox->value();
-			float x2 = (float)myUI->xReferenceBox->value();
-			float y1 = (float)myUI->yRangeMinBox->value();
-			float y2 = (float)myUI->yRangeMaxBox->value();
-
-			AddReferenceLine(c, x1, y1, x2, y2, myUI->xAxisBox->currentText(), myUI->xReferenceBox->value());
-			c++;
-		}
-		if(myUI->yReferenceEnabledBox->isChecked())
-		{
-			float y1 = (float)myUI->yReferenceBox->value();
-			float y2 = (float)myUI->yReferenceBox->value();
-			float x1 = (float)myUI->xRangeMinBox->value();
-			float x2 = (float)myUI->xRangeMaxBox->value();
-
-			AddReferenceLine(c, x1, y1, x2, y2, myUI->yAxisBox->currentText(), myUI->yReferenceBox->value());
-			c++;
-		}
-		for(int i = 0; i < grps; i++)
-		{
-			DataGroup* grp = data->GetSortedGroup(i);
-			if(grp->Size > 0)
-			{
-				vtkFloatArray* xData = vtkFloatArray::New();
-				vtkFloatArray* yData = vtkFloatArray::New();
-
-				for(int j = 0; j < grp->Size; j++)
-				{
-					xData->InsertNextTuple1(grp->Items[j]->Field[xField]);
-					yData->InsertNextTuple1(grp->Items[j]->Field[yField]);
-				}
-				selectedFieldData = vtkFieldData::New();
-				selectedFieldData->AddArray(xData);
-				selectedFieldData->AddArray(yData);
-
-				selectedDataObject = vtkDataObject::New();
-				selectedDataObject->SetFieldData(selectedFieldData);
-
-				
-				myPlot->AddDataObjectInput(selectedDataObject);
-				myPlot->SetPlotLines(c + 1, prefs->GetPlotPoints() ? 0 : 1);
-
-				xData->Delete();
-				yData->Delete();
-				selectedFieldData->Delete();
-				selectedDataObject->Delete();
-
-				float colorWeight = (float)c / (grps - 1);
-				double* color = colorMap->GetColor(colorWeight);
-				myPlot->SetPlotColor(c + 1, color);
-
-				//printf("added Group ID: %d, plot component: %d\n", i, c + 1);
-
-				myPlot->SetDataObjectXComponent(c + 1, 0);
-				myPlot->SetDataObjectYComponent(c + 1, 1);
-				myPlot->SetPlotLabel(c + 1, grp->Tag);
-				c++;
-			}
-		}
-
-
-		//myPlot->Modified();
-		//myPlotRenderer->Render();
-		//myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontFamilyToCourier();
-		myPlotRenderWindow->Render();
-
-		myPlot->SetPlotLabel(0, "Other datapoints");
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::AddReferenceLine(int c, float x1, float y1, float x2, float y2, QString name, float value)
-{
-	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
-
-	vtkFloatArray* xData = vtkFloatArray::New();
-	vtkFloatArray* yData = vtkFloatArray::New();
-
-	xData->InsertNextTuple1(x1);
-	xData->InsertNextTuple1(x2);
-	yData->InsertNextTuple1(y1);
-	yData->InsertNextTuple1(y2);
-
-	vtkFieldData* selectedFieldData = vtkFieldData::New();
-	selectedFieldData->AddArray(xData);
-	selectedFieldData->AddArray(yData);
-
-	vtkDataObject* selectedDataObject = vtkDataObject::New();
-	selectedDataObject->SetFieldData(selectedFieldData);
-
-	myPlot->AddDataObjectInput(selectedDataObject);
-	myPlot->SetPlotLines(c + 1, 1);
-
-	xData->Delete();
-	yData->Delete();
-	selectedFieldData->Delete();
-	selectedDataObject->Delete();
-
-	myPlot->SetPlotColor(c + 1, QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
-
-	myPlot->SetDataObjectXComponent(c + 1, 0);
-	myPlot->SetDataObjectYComponent(c + 1, 1);
-	QString refLabel = QString("%1 = %2").arg(name).arg(value);
-	myPlot->SetPlotLabel(c + 1, refLabel);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::Render()
-{
-	myPlotRenderWindow->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnSelectionChanged(int* sel)
-{
-	double x1 = sel[0];
-	double y1 = sel[1];
-	double x2 = sel[2];
-	double y2 = sel[3];
-	int xField = myUI->xAxisBox->currentIndex();
-	int yField = myUI->yAxisBox->currentIndex();
-	VisualizationManager* mng = myVizMng;
-
-	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x1, y1);
-	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x2, y2);
-	// Swap coordinates if necessary.
-	if(x1 > x2)
-	{
-		double tmp = x1;
-		x1 = x2;
-		x2 = tmp;
-	}
-	if(y1 > y2)
-	{
-		double tmp = y1;
-		y1 = y2;
-		y2 = tmp;
-	}	
-
-	if(myUI->zoomButton->isChecked())
-	{
-		myUI->xRangeMinBox->setValue(x1);
-		myUI->xRangeMaxBox->setValue(x2);
-
-		myUI->yRangeMinBox->setValue(y1);
-		myUI->yRangeMaxBox->setValue(y2);
-
-		//OnRangeChanged();
-		//myPlotRenderWindow->Render();
-	}
-	else
-	{
-		if(x1 == x2 && y1 == y2)
-		{
-			// If action was just a click, clear selected area.
-			myXFilter->Enabled = false;
-			myYFilter->Enabled = false;
-			myVizMng->GetDataSet()->ApplyFilters();
-		}
-		else
-		{
-			myXFilter->Enabled = true;
-			myXFilter->FieldId = xField;
-			myXFilter->Min = x1;
-			myXFilter->Max = x2;
-			myYFilter->Enabled = true;
-			myYFilter->FieldId = yField;
-
-			myYFilter->Min = y1;
-			myYFilter->Max = y2;
-
-			myVizMng->GetDataSet()->ApplyFilters();
-		}
-		mng->Update();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnAxisFieldChanged(int i)
-{
-	QString xAxis = myUI->xAxisBox->currentText();
-	QString yAxis = myUI->yAxisBox->currentText();
-
-	myUI->xRangeLabel->setText(xAxis + " range:");
-	myUI->yRangeLabel->setText(yAxis + " range:");
-	myUI->xTicksLabel->setText(xAxis + " ticks:");
-	myUI->yTicksLabel->setText(yAxis + " ticks:");
-	myUI->xReferenceEnabledBox->setText(xAxis + " reference line");
-	myUI->yReferenceEnabledBox->setText(yAxis + " reference line");
-
-	Update();
-	OnViewAllButtonClicked();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnViewAllButtonClicked()
-{
-	int xField = myUI->xAxisBox->currentIndex();
-	int yField = myUI->yAxisBox->currentIndex();
-	float* xr = myVizMng->GetDataSet()->GetFieldRange(xField);
-	float* yr = myVizMng->GetDataSet()->GetFieldRange(yField);
-	myPlot->SetXRange(xr[0], xr[1]);
-	myPlot->SetYRange(yr[0], yr[1]);
-
-	myUI->xRangeMinBox->setMinimum(xr[0]);
-	myUI->xRangeMaxBox->setMinimum(xr[0]);
-	myUI->xRangeMinBox->setMaximum(xr[1]);
-	myUI->xRangeMaxBox->setMaximum(xr[1]);
-	myUI->xReferenceBox->setMinimum(xr[0]);
-	myUI->xReferenceBox->setMaximum(xr[1]);
-
-	myUI->yRangeMinBox->setMinimum(yr[0]);
-	myUI->yRangeMaxBox->setMinimum(yr[0]);
-	myUI->yRangeMinBox->setMaximum(yr[1]);
-	myUI->yRangeMaxBox->setMaximum(yr[1]);
-	myUI->yReferenceBox->setMinimum(yr[0]);
-	myUI->yReferenceBox->setMaximum(yr[1]);
-
-	myUI->xRangeMinBox->setValue(xr[0]);
-	myUI->xRangeMaxBox->setValue(xr[1]);
-
-	myUI->yRangeMinBox->setValue(yr[0]);
-	myUI->yRangeMaxBox->setValue(yr[1]);
-
-	myPlotRenderWindow->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnRangeChanged()
-{
-	myPlot->SetXRange(myUI->xRangeMinBox->value(), myUI->xRangeMaxBox->value());
-	myPlot->SetYRange(myUI->yRangeMinBox->value(), myUI->yRangeMaxBox->value());
-
-	//myUI->zoomButton->setChecked(true);
-
-	myPlotRenderWindow->Render();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnExportImageButtonClicked()
-{
-	Utils::SaveScreenshot(myPlotRenderWindow);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnReferenceLinesChanged()
-{
-	Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void PlotView::OnLegendPositionChanged()
-{
-	SetPlotProperties();
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "AppConfig.h"
+#include "Preferences.h"
+#include "PlotView.h"
+#include "DataSet.h"
+#include "FrameScheduler.h"
+#include "GeoDataView.h"
+#include "Plot.h"
+#include "SpatialIndex.h"
+#include "TimePyramid.h"
+#include "Utils.h"
+#include "VisualizationManager.h"
+#include "ui_MainWindow.h"
+#include "VtkDataManager.h"
+
+#include "vtkAxisActor2D.h"
+#include "vtkLegendBoxActor.h"
+
+#include <QDateTime>
+#include <QToolTip>
+
+#include <vtkAttributeDataToFieldDataFilter.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkDataObject.h>
+#include <vtkFieldData.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+#include <vtkInteractorStyleRubberband2D.h>
+#include <vtkPointData.h>
+#include <vtkPointSet.h>
+#include <vtkProperty2D.h>
+#include <vtkRenderWindowInteractor.h>
+#include <vtkRenderer.h>
+#include <vtkRenderWindow.h>
+#include <vtkTextProperty.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+VTK_CALLBACK(SelectionChangedCallback, PlotView, OnSelectionChanged(reinterpret_cast<int*>(data)));
+VTK_CALLBACK(MouseMoveCallback, PlotView, OnMouseMove());
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+PlotView::PlotView(VisualizationManager* mng, int index): 
+	DockedTool(mng, QString("Plot Window %1").arg(index), Qt::RightDockWidgetArea),
+	myCurrentEntry(NULL),
+	myTimeSeriesOffset(0),
+	myBrush(NULL),
+	myBrushedDataValid(false)
+{
+	myVizMng = mng;
+	GetMenuAction()->setIcon(QIcon(":/icons/PlotView.png"));
+
+	myReferenceData[0] = NewPlotData();
+	myReferenceData[1] = NewPlotData();
+	myBrushedData = NewPlotData();
+	for(int i = 0; i < 3; i++) myTimeSeriesData[i] = NewPlotData();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+PlotView::~PlotView()
+{
+	for(int i = 0; i < myCache.size(); i++)
+	{
+		DeleteCacheEntry(myCache[i]);
+	}
+	myReferenceData[0]->Delete();
+	myReferenceData[1]->Delete();
+	myBrushedData->Delete();
+	for(int i = 0; i < 3; i++) myTimeSeriesData[i]->Delete();
+	if(myBrush != NULL)
+	{
+		myVizMng->GetDataSet()->RemoveBrush(myBrush);
+		delete myBrush;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::Initialize()
+{
+	VisualizationManager* mng = myVizMng;
+
+	myBrush = new DataBrush();
+	myVizMng->GetDataSet()->AddBrush(myBrush);
+
+	myVizMng->GetDataSet()->AddListener(this, 
+		DataSet::FilteredChanged | DataSet::GroupingChanged | DataSet::FieldValuesChanged | DataSet::BrushChanged);
+
+	SetupUI();
+
+	// Setup VTK stuff.
+    myPlot = Plot::New();
+    myPlot->GetPositionCoordinate()->SetCoordinateSystemToNormalizedViewport();
+    myPlot->GetPositionCoordinate()->SetValue(0.0f, 0.0f);
+    myPlot->SetPlotPoints(0);
+    // Zooming only changes the plot view transform, without regenerating the plot geometry.
+    myPlot->ViewTransformOn();
+    myPlot->SetWidth(1.0f);
+    myPlot->SetHeight(1.0f);
+
+    myPlotRenderer = vtkRenderer::New();
+    myPlotRenderer->AddActor2D(myPlot);
+	
+	myPlotRenderWindow = myUI->vtkView->GetRenderWindow();
+	myInteractorStyle = vtkInteractorStyleRubberBand2D::New();
+	myInteractorStyle->AddObserver("SelectionChangedEvent", new SelectionChangedCallback(this));
+	myPlotRenderWindow->GetInteractor()->SetInteractorStyle(myInteractorStyle);
+	myPlotRenderWindow->GetInteractor()->AddObserver(vtkCommand::MouseMoveEvent, new MouseMoveCallback(this));
+
+    myPlotDataFilter = vtkAttributeDataToFieldDataFilter::New();
+
+	myUI->vtkView->GetRenderWindow()->AddRenderer(myPlotRenderer);
+
+	myVizMng->GetDataSet()->ApplyFilters();
+
+	SetPlotProperties();
+
+	//Update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::SetupUI()
+{
+	DataSet* data = myVizMng->GetDataSet();
+
+	myUI = new Ui_PlotViewDock();
+	myUI->setupUi(GetDockWidget());
+	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
+    {
+        myUI->xAxisBox->addItem(data->GetFieldName(i), i);
+        myUI->yAxisBox->addItem(data->GetFieldName(i), i);
+    }
+	
+	myUI->xLegendPositionSlider->setValue(70);
+	myUI->yLegendPositionSlider->setValue(0);
+	myUI->plotXSlider->setValue(0);
+	myUI->plotWidthSlider->setValue(100);
+
+	//myUI->layoutBox->setVisible(false);
+	// Setup some default plot to show something.
+	myUI->xAxisBox->setCurrentIndex(0);
+	myUI->yAxisBox->setCurrentIndex(1);
+
+    connect(myUI->xAxisBox, SIGNAL(currentIndexChanged(int)), SLOT(OnAxisFieldChanged(int)));
+    connect(myUI->yAxisBox, SIGNAL(currentIndexChanged(int)), SLOT(OnAxisFieldChanged(int)));
+	connect(myUI->viewAllButton, SIGNAL(clicked()),	SLOT(OnViewAllButtonClicked()));
+	connect(myUI->exportImageButton, SIGNAL(clicked()),	SLOT(OnExportImageButtonClicked()));
+
+	connect(myUI->xRangeMinBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
+	connect(myUI->yRangeMinBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
+	connect(myUI->xRangeMaxBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
+	connect(myUI->yRangeMaxBox, SIGNAL(valueChanged(double)), SLOT(OnRangeChanged()));
+
+	connect(myUI->xMinorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
+	connect(myUI->xMajorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
+	connect(myUI->yMinorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
+	connect(myUI->yMajorTicksBox, SIGNAL(valueChanged(int)), SLOT(SetPlotProperties()));
+
+	connect(myUI->xReferenceEnabledBox, SIGNAL(toggled(bool)), SLOT(OnReferenceLinesChanged()));
+	connect(myUI->yReferenceEnabledBox, SIGNAL(toggled(bool)), SLOT(OnReferenceLinesChanged()));
+	connect(myUI->xReferenceBox, SIGNAL(valueChanged(double)), SLOT(OnReferenceLinesChanged()));
+	connect(myUI->yReferenceBox, SIGNAL(valueChanged(double)), SLOT(OnReferenceLinesChanged()));
+
+	connect(myUI->densityBox, SIGNAL(toggled(bool)), SLOT(OnDensityModeChanged()));
+	connect(myUI->groupOverlayBox, SIGNAL(toggled(bool)), SLOT(OnDensityModeChanged()));
+	connect(myUI->timeSeriesBox, SIGNAL(toggled(bool)), SLOT(OnTimeSeriesModeChanged()));
+
+	connect(myUI->yLegendPositionSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
+	connect(myUI->xLegendPositionSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
+	connect(myUI->plotXSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
+	connect(myUI->plotWidthSlider, SIGNAL(valueChanged(int)), SLOT(OnLegendPositionChanged()));
+
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::SetPlotProperties()
+{
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+
+	myPlotRenderer->SetBackground(QCOLOR_TO_VTK(prefs->GetPlotBackgroundColor()));
+
+	int labelFontSize = prefs->GetPlotLabelFontSize();
+
+	vtkTextProperty* textProp = NULL;
+
+	// Set plot parameters
+	myPlot->SetPlotColor(0, QCOLOR_TO_VTK(prefs->GetPlotDefaultDataColor()));
+	myPlot->GetXAxisActor2D()->GetProperty()->SetLineWidth(1);
+	myPlot->GetXAxisActor2D()->GetProperty()->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+	myPlot->GetYAxisActor2D()->GetProperty()->SetLineWidth(1);
+	myPlot->GetYAxisActor2D()->GetProperty()->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+
+	myPlot->GetXAxisActor2D()->SetLabelFactor((float)labelFontSize / 10.0f);
+	myPlot->GetYAxisActor2D()->SetLabelFactor((float)labelFontSize / 10.0f);
+	myPlot->GetTitleTextProperty()->SetFontSize(labelFontSize);
+	myPlot->GetTitleTextProperty()->SetFontFamilyToCourier();
+
+	myPlot->GetLegendActor()->SetDragable(0);
+	myPlot->SetLegend(prefs->GetPlotLegend() ? 1 : 0);
+
+	float plotX = (float)myUI->plotXSlider->value() / 100;
+	float plotWidth = (float)myUI->plotWidthSlider->value() / 100;
+    myPlot->SetWidth(plotWidth);
+	myPlot->SetPosition(plotX, 0);
+
+	if(prefs->GetPlotLegend())
+	{
+		DataSet* data = myVizMng->GetDataSet();
+		// Set legend size.
+		int nonEmptyGroups = 1;
+		int grps = data->GetNumGroups();
+		for(int i = 0; i < grps; i++)
+		{
+			DataGroup* grp = data->GetGroup(i);
+			if(grp->Size > 0) nonEmptyGroups++;
+		}
+		// The legend only lists up to a maximum number of groups.
+		if(nonEmptyGroups > myPlot->GetMaxGroupLegendEntries() + 1) nonEmptyGroups = myPlot->GetMaxGroupLegendEntries() + 1;
+
+		// Take into account enabled reference lines when sizing legend box.
+		if(myUI->xReferenceEnabledBox->isChecked()) nonEmptyGroups++;
+		if(myUI->yReferenceEnabledBox->isChecked()) nonEmptyGroups++;
+
+		int* size = myPlotRenderWindow->GetSize();
+		float yPos = (float)nonEmptyGroups * 20 / size[1];
+		if(yPos > 1) yPos = 1;
+
+		float xpp = (float)myUI->xLegendPositionSlider->value() / 100;
+		float ypp = (float)myUI->yLegendPositionSlider->value() / 100;
+		//xpp *= 1 / plotWidth;
+		//float xpp = 1;
+		//float ypp = 0;
+
+		myPlot->SetLegendPosition(xpp, 1 - yPos - ypp);
+		myPlot->SetLegendPosition2(0.3f, yPos);
+	}
+
+	// X axis labels
+	textProp = myPlot->GetXAxisActor2D()->GetLabelTextProperty();
+	textProp->ShadowOff();
+	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+	textProp->SetFontFamilyToCourier();
+	//textProp->SetFontSize(labelFontSize);
+
+	// X axis title
+	textProp = myPlot->GetXAxisActor2D()->GetTitleTextProperty();
+	textProp->ShadowOff();
+	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+	textProp->SetFontFamilyToCourier();
+
+	// Y axis labels
+	textProp = myPlot->GetYAxisActor2D()->GetLabelTextProperty();
+	textProp->ShadowOff();
+	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+	textProp->SetFontFamilyToCourier();
+
+	// Y axis title
+	textProp = myPlot->GetYAxisActor2D()->GetTitleTextProperty();
+	textProp->ShadowOff();
+	textProp->SetColor(QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+	textProp->SetFontFamilyToCourier();
+
+	myPlot->GetProperty()->SetLineWidth(2);
+
+	// Set axis labels properties.
+	//myPlot->SetAdjustXLabels(prefs->GetAdjustPlotLabels());
+	//myPlot->SetAdjustYLabels(prefs->GetAdjustPlotLabels());
+	
+	myPlot->SetAdjustXLabels(0);
+	myPlot->SetAdjustYLabels(0);
+
+	myPlot->SetNumberOfXLabels(myUI->xMajorTicksBox->value());
+	myPlot->SetNumberOfXMinorTicks(myUI->xMinorTicksBox->value());
+
+	myPlot->SetNumberOfYLabels(myUI->yMajorTicksBox->value());
+	myPlot->SetNumberOfYMinorTicks(myUI->yMinorTicksBox->value());
+
+	myPlotRenderWindow->Render();
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::Update()
+{
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+
+	int xField = myUI->xAxisBox->currentIndex();
+	int yField = myUI->yAxisBox->currentIndex();
+
+	SetPlotProperties();
+
+	myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontSize(5);
+	myPlot->GetLegendActor()->GetEntryTextProperty()->SetFontFamilyToCourier();
+	myPlot->GetLegendActor()->GetEntryTextProperty()->Modified();
+
+	if(myUI->timeSeriesBox->isChecked())
+	{
+		UpdateTimeSeries();
+		myPlotRenderWindow->Render();
+		return;
+	}
+
+	// If I use the same field on both coordinates, the XYPlotActor apparently gets stuck...
+	if(xField != yField)
+	{
+		PlotCacheKey key;
+		key.XField = xField;
+		key.YField = yField;
+		key.Subset = DataSet::FilteredData;
+		key.GroupingTagId = prefs->GetGroupingTagId();
+		key.GroupingSubset = prefs->GetGroupingSubset();
+
+		// Only refill the parts of the cached plot data that have been invalidated.
+		PlotCacheEntry* entry = GetCacheEntry(key);
+		if(!entry->DataValid) UpdateCacheData(entry);
+		if(!entry->GroupsValid) UpdateCacheGroups(entry);
+
+		// The brushed data follows the current plot fields.
+		if(entry != myCurrentEntry) myBrushedDataValid = false;
+		myCurrentEntry = entry;
+		UpdatePlotInputs();
+		myPlotRenderWindow->Render();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+PlotView::PlotCacheEntry* PlotView::GetCacheEntry(const PlotCacheKey& key)
+{
+	for(int i = 0; i < myCache.size(); i++)
+	{
+		if(myCache[i]->Key == key)
+		{
+			// Move the entry to the front of the cache list (most recently used).
+			PlotCacheEntry* entry = myCache.takeAt(i);
+			myCache.prepend(entry);
+			return entry;
+		}
+	}
+
+	// Evict the least recently used entry.
+	if(myCache.size() >= MAX_CACHE_ENTRIES)
+	{
+		PlotCacheEntry* entry = myCache.takeLast();
+		if(entry == myCurrentEntry)
+		{
+			myPlot->RemoveAllInputs();
+			myPlot->SetGroupInput(NULL);
+			myCurrentEntry = NULL;
+		}
+		DeleteCacheEntry(entry);
+	}
+
+	PlotCacheEntry* entry = new PlotCacheEntry();
+	entry->Key = key;
+	entry->Data = NewPlotData();
+	entry->GroupData = NewPlotData(true);
+	entry->Index = new SpatialIndex();
+	entry->DataValid = false;
+	entry->GroupsValid = false;
+	entry->IndexValid = false;
+	myCache.prepend(entry);
+	return entry;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::DeleteCacheEntry(PlotCacheEntry* entry)
+{
+	entry->Data->Delete();
+	entry->GroupData->Delete();
+	delete entry->Index;
+	delete entry;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::InvalidateCache(int field, bool data, bool groups)
+{
+	for(int i = 0; i < myCache.size(); i++)
+	{
+		PlotCacheEntry* entry = myCache[i];
+		if(field == -1 || entry->Key.XField == field || entry->Key.YField == field)
+		{
+			if(data) entry->DataValid = false;
+			if(groups) entry->GroupsValid = false;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+vtkDataObject* PlotView::NewPlotData(bool grouped)
+{
+	vtkFloatArray* xData = vtkFloatArray::New();
+	vtkFloatArray* yData = vtkFloatArray::New();
+
+	vtkFieldData* fieldData = vtkFieldData::New();
+	fieldData->AddArray(xData);
+	fieldData->AddArray(yData);
+	xData->Delete();
+	yData->Delete();
+
+	// Grouped plot data has a third column with the group index of each row.
+	if(grouped)
+	{
+		vtkIntArray* groupData = vtkIntArray::New();
+		fieldData->AddArray(groupData);
+		groupData->Delete();
+	}
+
+	vtkDataObject* dataObject = vtkDataObject::New();
+	dataObject->SetFieldData(fieldData);
+	fieldData->Delete();
+
+	return dataObject;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::ResizePlotData(vtkDataObject* dataObject, int length, float** x, float** y, int** groups)
+{
+	// Arrays only reallocate when growing, so cached data objects keep their storage across updates.
+	vtkFloatArray* xData = vtkFloatArray::SafeDownCast(dataObject->GetFieldData()->GetArray(0));
+	vtkFloatArray* yData = vtkFloatArray::SafeDownCast(dataObject->GetFieldData()->GetArray(1));
+	xData->SetNumberOfValues(length);
+	yData->SetNumberOfValues(length);
+	xData->Modified();
+	yData->Modified();
+	*x = xData->GetPointer(0);
+	*y = yData->GetPointer(0);
+	if(groups != NULL)
+	{
+		vtkIntArray* groupData = vtkIntArray::SafeDownCast(dataObject->GetFieldData()->GetArray(2));
+		groupData->SetNumberOfValues(length);
+		groupData->Modified();
+		*groups = groupData->GetPointer(0);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdateCacheData(PlotCacheEntry* entry)
+{
+	DataSet* data = myVizMng->GetDataSet();
+	int xField = entry->Key.XField;
+	int yField = entry->Key.YField;
+
+	// Gather the subset values from the dataset field columns.
+	int length = data->GetDataLength(entry->Key.Subset);
+	float* x;
+	float* y;
+	ResizePlotData(entry->Data, length, &x, &y);
+	for(int i = 0; i < length; i++)
+	{
+		DataItem* item = data->GetData(i, entry->Key.Subset);
+		x[i] = item->Field[xField];
+		y[i] = item->Field[yField];
+	}
+	entry->DataValid = true;
+	// The hover index is rebuilt the next time it is used.
+	entry->IndexValid = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdateCacheIndex(PlotCacheEntry* entry)
+{
+	DataSet* data = myVizMng->GetDataSet();
+	float* xr = data->GetFieldRange(entry->Key.XField);
+	float* yr = data->GetFieldRange(entry->Key.YField);
+
+	// Normalize both axes to the field ranges, so that plot space distances are comparable along x and y.
+	entry->IndexMin[0] = xr[0];
+	entry->IndexMin[1] = yr[0];
+	entry->IndexScale[0] = xr[1] > xr[0] ? 1.0f / (xr[1] - xr[0]) : 1.0f;
+	entry->IndexScale[1] = yr[1] > yr[0] ? 1.0f / (yr[1] - yr[0]) : 1.0f;
+
+	vtkFloatArray* xData = vtkFloatArray::SafeDownCast(entry->Data->GetFieldData()->GetArray(0));
+	vtkFloatArray* yData = vtkFloatArray::SafeDownCast(entry->Data->GetFieldData()->GetArray(1));
+	int length = xData->GetNumberOfTuples();
+	float* x = xData->GetPointer(0);
+	float* y = yData->GetPointer(0);
+
+	// Points with missing values are not indexed.
+	QVector<float> points;
+	points.reserve(length * 3);
+	entry->IndexRows.clear();
+	entry->IndexRows.reserve(length);
+	for(int i = 0; i < length; i++)
+	{
+		if(x[i] != x[i] || y[i] != y[i]) continue;
+		points.append((x[i] - entry->IndexMin[0]) * entry->IndexScale[0]);
+		points.append((y[i] - entry->IndexMin[1]) * entry->IndexScale[1]);
+		points.append(0);
+		entry->IndexRows.append(i);
+	}
+	entry->Index->Build(points.data(), entry->IndexRows.size());
+	entry->IndexValid = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdateBrushedData()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	PlotCacheEntry* entry = myCurrentEntry;
+	int xField = entry->Key.XField;
+	int yField = entry->Key.YField;
+
+	// Brushed rows are read from the dataset mask, which already combines the pass bitmaps of all the brushes.
+	const unsigned char* mask = data->GetMaskBuffer();
+	int length = data->GetDataLength(entry->Key.Subset);
+	float* x;
+	float* y;
+	ResizePlotData(myBrushedData, data->GetNumBrushedRows(), &x, &y);
+	int k = 0;
+	for(int i = 0; i < length && k < data->GetNumBrushedRows(); i++)
+	{
+		DataItem* item = data->GetData(i, entry->Key.Subset);
+		if(mask[data->GetRowId(item)] & DataSet::MaskBrushed)
+		{
+			x[k] = item->Field[xField];
+			y[k] = item->Field[yField];
+			k++;
+		}
+	}
+	// The subset may not contain all the brushed rows.
+	ResizePlotData(myBrushedData, k, &x, &y);
+	myBrushedDataValid = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdateCacheGroups(PlotCacheEntry* entry)
+{
+	DataSet* data = myVizMng->GetDataSet();
+	int xField = entry->Key.XField;
+	int yField = entry->Key.YField;
+
+	int grps = data->GetNumSortedGroups();
+
+	// Non empty groups are stored one after the other in the group data object.
+	int length = 0;
+	entry->GroupLabels.clear();
+	for(int i = 0; i < grps; i++)
+	{
+		DataGroup* grp = data->GetSortedGroup(i);
+		if(grp->Size > 0)
+		{
+			length += grp->Size;
+			entry->GroupLabels.append(grp->Tag);
+		}
+	}
+
+	float* x;
+	float* y;
+	int* groups;
+	ResizePlotData(entry->GroupData, length, &x, &y, &groups);
+	int c = 0;
+	int k = 0;
+	for(int i = 0; i < grps; i++)
+	{
+		DataGroup* grp = data->GetSortedGroup(i);
+		if(grp->Size > 0)
+		{
+			for(int j = 0; j < grp->Size; j++)
+			{
+				x[k] = grp->Items[j]->Field[xField];
+				y[k] = grp->Items[j]->Field[yField];
+				groups[k] = c;
+				k++;
+			}
+			c++;
+		}
+	}
+	entry->GroupsValid = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdatePlotInputs()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+	PlotCacheEntry* entry = myCurrentEntry;
+
+	// Plot inputs are just references to the cached data objects: reassembling them does not touch
+	// the plot data.
+	myPlot->RemoveAllInputs();
+
+	myPlot->AddDataObjectInput(entry->Data);
+
+	myPlot->PlotCurveLinesOn();
+	myPlot->SetPlotLines(0, 0);
+	myPlot->PlotPointsOn();
+	myPlot->SetXValuesToValue();
+	myPlot->SetDataObjectXComponent(0, 0);
+	myPlot->SetDataObjectYComponent(0, 1);
+
+	char title[256];
+	sprintf(title, "%s vs %s", 
+		data->GetFieldName(entry->Key.YField).ascii(), 
+		data->GetFieldName(entry->Key.XField).ascii());
+	myPlot->SetXTitle(title);
+	myPlot->SetYTitle("");
+
+	vtkColorTransferFunction* colorMap = prefs->GetPlotColorTransferFunction();		
+
+	int c = 0;
+	if(myUI->xReferenceEnabledBox->isChecked())
+	{
+		float x1 = (float)myUI->xReferenceBox->value();
+		float x2 = (float)myUI->xReferenceBox->value();
+		float y1 = (float)myUI->yRangeMinBox->value();
+		float y2 = (float)myUI->yRangeMaxBox->value();
+
+		AddReferenceLine(c, x1, y1, x2, y2, myUI->xAxisBox->currentText(), myUI->xReferenceBox->value());
+		c++;
+	}
+	if(myUI->yReferenceEnabledBox->isChecked())
+	{
+		float y1 = (float)myUI->yReferenceBox->value();
+		float y2 = (float)myUI->yReferenceBox->value();
+		float x1 = (float)myUI->xRangeMinBox->value();
+		float x2 = (float)myUI->xRangeMaxBox->value();
+
+		AddReferenceLine(c, x1, y1, x2, y2, myUI->yAxisBox->currentText(), myUI->yReferenceBox->value());
+		c++;
+	}
+	// Rows inside the brushes of all the plot views.
+	if(data->GetNumBrushedRows() > 0)
+	{
+		if(!myBrushedDataValid) UpdateBrushedData();
+		myPlot->AddDataObjectInput(myBrushedData);
+		myPlot->SetPlotLines(c + 1, 0);
+		myPlot->SetPlotColor(c + 1, QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+		myPlot->SetDataObjectXComponent(c + 1, 0);
+		myPlot->SetDataObjectYComponent(c + 1, 1);
+		myPlot->SetPlotLabel(c + 1, "Brushed datapoints");
+		c++;
+	}
+	else if(!myBrushedDataValid)
+	{
+		float* x;
+		float* y;
+		ResizePlotData(myBrushedData, 0, &x, &y);
+		myBrushedDataValid = true;
+	}
+	// All groups are drawn as a single batch, colored by group. In density mode, groups are only 
+	// drawn when the group overlay is enabled.
+	int grps = entry->GroupLabels.size();
+	if(grps > 0 && !(myUI->densityBox->isChecked() && !myUI->groupOverlayBox->isChecked()))
+	{
+		myPlot->SetGroupInput(entry->GroupData);
+		myPlot->SetNumberOfGroups(grps);
+		myPlot->SetGroupLines(prefs->GetPlotPoints() ? 0 : 1);
+		for(int i = 0; i < grps; i++)
+		{
+			float colorWeight = grps > 1 ? (float)i / (grps - 1) : 0;
+			myPlot->SetGroupColor(i, colorMap->GetColor(colorWeight));
+			myPlot->SetGroupLabel(i, entry->GroupLabels[i].ascii());
+		}
+	}
+	else
+	{
+		myPlot->SetGroupInput(NULL);
+		myPlot->SetNumberOfGroups(0);
+	}
+
+	myPlot->SetPlotLabel(0, "Other datapoints");
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::UpdateTimeSeries()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+	int yField = myUI->yAxisBox->currentIndex();
+	const QVector<time_t>& times = data->GetSortedTimestamps();
+	TimePyramid* pyramid = data->GetTimePyramid(yField);
+	time_t origin = data->GetTimestampRange()[0];
+
+	// Hover, brushing and groups are not supported on time series.
+	myCurrentEntry = NULL;
+	myPlot->RemoveAllInputs();
+	myPlot->SetGroupInput(NULL);
+	myPlot->SetNumberOfGroups(0);
+
+	// Visible time span. Times are plotted relative to its start, since floats only resolve a few seconds 
+	// over days since the first sample.
+	time_t t1 = origin + (time_t)floor(myUI->xRangeMinBox->value() * SECONDS_PER_DAY);
+	time_t t2 = origin + (time_t)ceil(myUI->xRangeMaxBox->value() * SECONDS_PER_DAY);
+	myTimeSeriesOffset = (double)(t1 - origin) / SECONDS_PER_DAY;
+	myPlot->SetViewRange(
+		myUI->xRangeMinBox->value() - myTimeSeriesOffset, myUI->xRangeMaxBox->value() - myTimeSeriesOffset, 
+		myUI->yRangeMinBox->value(), myUI->yRangeMaxBox->value());
+	if(times.isEmpty()) return;
+
+	// Draw the samples if the span contains few enough of them, otherwise the finest pyramid level 
+	// with few enough buckets. One point past each end of the span is kept, so that lines reach the plot borders.
+	int level = -1;
+	int first = qLowerBound(times.begin(), times.end(), t1) - times.begin();
+	int last = qUpperBound(times.begin(), times.end(), t2) - times.begin();
+	int length = times.size();
+	if(last - first > MAX_TIME_SERIES_POINTS)
+	{
+		for(level = TimePyramid::Minute; level < TimePyramid::Day; level++)
+		{
+			if(pyramid->FindBucket(level, t2) - pyramid->FindBucket(level, t1) < MAX_TIME_SERIES_POINTS) break;
+		}
+		first = pyramid->FindBucket(level, t1);
+		last = pyramid->FindBucket(level, t2) + 1;
+		length = pyramid->GetBuckets(level).size();
+	}
+	first = max(0, first - 1);
+	last = min(length, last + 1);
+	int n = max(0, last - first);
+
+	float* x;
+	float* y;
+	if(level == -1)
+	{
+		const float* values = pyramid->GetValues().constData();
+		ResizePlotData(myTimeSeriesData[0], n, &x, &y);
+		for(int i = 0; i < n; i++)
+		{
+			x[i] = (float)((double)(times[first + i] - t1) / SECONDS_PER_DAY);
+			y[i] = values[first + i];
+		}
+	}
+	else
+	{
+		// Buckets are drawn at their center.
+		const TimePyramid::Bucket* buckets = pyramid->GetBuckets(level).constData() + first;
+		double offset = TimePyramid::BucketSeconds[level] / 2.0;
+		float* mx;
+		float* my;
+		float* Mx;
+		float* My;
+		ResizePlotData(myTimeSeriesData[0], n, &x, &y);
+		ResizePlotData(myTimeSeriesData[1], n, &mx, &my);
+		ResizePlotData(myTimeSeriesData[2], n, &Mx, &My);
+		for(int i = 0; i < n; i++)
+		{
+			x[i] = mx[i] = Mx[i] = (float)(((buckets[i].Start - t1) + offset) / SECONDS_PER_DAY);
+			y[i] = buckets[i].Mean;
+			my[i] = buckets[i].Min;
+			My[i] = buckets[i].Max;
+		}
+	}
+
+	static const char* levelNames[] = { "minute", "hour", "day" };
+	QString fieldName = data->GetFieldName(yField);
+	int numInputs = level == -1 ? 1 : 3;
+	myPlot->PlotCurveLinesOn();
+	myPlot->PlotPointsOn();
+	myPlot->SetXValuesToValue();
+	for(int i = 0; i < numInputs; i++)
+	{
+		myPlot->AddDataObjectInput(myTimeSeriesData[i]);
+		myPlot->SetDataObjectXComponent(i, 0);
+		myPlot->SetDataObjectYComponent(i, 1);
+		myPlot->SetPlotLines(i, 1);
+		myPlot->SetPlotPoints(i, level == -1 ? 1 : 0);
+		myPlot->SetPlotColor(i, QCOLOR_TO_VTK(i == 0 ? prefs->GetPlotDefaultDataColor() : prefs->GetPlotForegroundColor()));
+	}
+	if(level == -1)
+	{
+		myPlot->SetPlotLabel(0, fieldName.ascii());
+	}
+	else
+	{
+		myPlot->SetPlotLabel(0, QString("%1 mean per %2").arg(fieldName).arg(levelNames[level]).ascii());
+		myPlot->SetPlotLabel(1, QString("%1 minimum per %2").arg(fieldName).arg(levelNames[level]).ascii());
+		myPlot->SetPlotLabel(2, QString("%1 maximum per %2").arg(fieldName).arg(levelNames[level]).ascii());
+	}
+
+	QString title = QString("%1 vs days since %2").arg(fieldName)
+		.arg(QDateTime::fromTime_t(t1).toString("yyyy-MM-dd hh:mm:ss"));
+	myPlot->SetXTitle(title.ascii());
+	myPlot->SetYTitle("");
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::GetXAxisRange(float range[2])
+{
+	DataSet* data = myVizMng->GetDataSet();
+	if(myUI->timeSeriesBox->isChecked())
+	{
+		time_t* tr = data->GetTimestampRange();
+		range[0] = 0;
+		range[1] = tr[1] > tr[0] ? (float)(tr[1] - tr[0]) / SECONDS_PER_DAY : 1.0f;
+	}
+	else
+	{
+		float* fr = data->GetFieldRange(myUI->xAxisBox->currentIndex());
+		range[0] = fr[0];
+		range[1] = fr[1];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::AddReferenceLine(int c, float x1, float y1, float x2, float y2, QString name, float value)
+{
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+
+	// Reference lines use their own small data objects, updated in place.
+	vtkDataObject* dataObject = myReferenceData[c];
+	float* x;
+	float* y;
+	ResizePlotData(dataObject, 2, &x, &y);
+	x[0] = x1;
+	x[1] = x2;
+	y[0] = y1;
+	y[1] = y2;
+
+	myPlot->AddDataObjectInput(dataObject);
+	myPlot->SetPlotLines(c + 1, 1);
+
+	myPlot->SetPlotColor(c + 1, QCOLOR_TO_VTK(prefs->GetPlotForegroundColor()));
+
+	myPlot->SetDataObjectXComponent(c + 1, 0);
+	myPlot->SetDataObjectYComponent(c + 1, 1);
+	QString refLabel = QString("%1 = %2").arg(name).arg(value);
+	myPlot->SetPlotLabel(c + 1, refLabel);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::Render()
+{
+	myPlotRenderWindow->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnSelectionChanged(int* sel)
+{
+	double x1 = sel[0];
+	double y1 = sel[1];
+	double x2 = sel[2];
+	double y2 = sel[3];
+	int xField = myUI->xAxisBox->currentIndex();
+	int yField = myUI->yAxisBox->currentIndex();
+	VisualizationManager* mng = myVizMng;
+
+	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x1, y1);
+	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x2, y2);
+	// Swap coordinates if necessary.
+	if(x1 > x2)
+	{
+		double tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+	if(y1 > y2)
+	{
+		double tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}	
+
+	if(myUI->zoomButton->isChecked())
+	{
+		// Set all the range boxes before applying the new range, so the plot is only rendered once.
+		myUI->xRangeMinBox->blockSignals(true);
+		myUI->xRangeMaxBox->blockSignals(true);
+		myUI->yRangeMinBox->blockSignals(true);
+		myUI->yRangeMaxBox->blockSignals(true);
+
+		// Time series plot coordinates are relative to the visible span start.
+		double xOffset = myUI->timeSeriesBox->isChecked() ? myTimeSeriesOffset : 0;
+		myUI->xRangeMinBox->setValue(x1 + xOffset);
+		myUI->xRangeMaxBox->setValue(x2 + xOffset);
+
+		myUI->yRangeMinBox->setValue(y1);
+		myUI->yRangeMaxBox->setValue(y2);
+
+		myUI->xRangeMinBox->blockSignals(false);
+		myUI->xRangeMaxBox->blockSignals(false);
+		myUI->yRangeMinBox->blockSignals(false);
+		myUI->yRangeMaxBox->blockSignals(false);
+
+		OnRangeChanged();
+	}
+	else if(!myUI->timeSeriesBox->isChecked())
+	{
+		// Update this view brush. Only the brush bitmaps are recombined: the data is not filtered again.
+		if(x1 == x2 && y1 == y2)
+		{
+			// If action was just a click, clear the brushed area.
+			myBrush->Enabled = false;
+		}
+		else
+		{
+			myBrush->Enabled = true;
+			myBrush->XFieldId = xField;
+			myBrush->XMin = x1;
+			myBrush->XMax = x2;
+			myBrush->YFieldId = yField;
+			myBrush->YMin = y1;
+			myBrush->YMax = y2;
+		}
+		myVizMng->GetDataSet()->UpdateBrush(myBrush);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnMouseMove()
+{
+	PlotCacheEntry* entry = myCurrentEntry;
+	vtkRenderWindowInteractor* interactor = myPlotRenderWindow->GetInteractor();
+	int* pos = interactor->GetEventPosition();
+	double u = pos[0];
+	double v = pos[1];
+
+	if(!myUI->hoverBox->isChecked() || entry == NULL || !entry->DataValid ||
+		!myPlot->IsInPlot(myPlotRenderer, u, v))
+	{
+		QToolTip::hideText();
+		return;
+	}
+	if(!entry->IndexValid) UpdateCacheIndex(entry);
+
+	// Look for candidates in a box around the mouse, then pick the closest one on screen.
+	double x1 = u - HOVER_TOLERANCE;
+	double y1 = v - HOVER_TOLERANCE;
+	double x2 = u + HOVER_TOLERANCE;
+	double y2 = v + HOVER_TOLERANCE;
+	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x1, y1);
+	myPlot->ViewportToPlotCoordinate(myPlotRenderer, x2, y2);
+	float boxMin[3];
+	float boxMax[3];
+	boxMin[0] = (float)((min(x1, x2) - entry->IndexMin[0]) * entry->IndexScale[0]);
+	boxMin[1] = (float)((min(y1, y2) - entry->IndexMin[1]) * entry->IndexScale[1]);
+	boxMax[0] = (float)((max(x1, x2) - entry->IndexMin[0]) * entry->IndexScale[0]);
+	boxMax[1] = (float)((max(y1, y2) - entry->IndexMin[1]) * entry->IndexScale[1]);
+	boxMin[2] = -1;
+	boxMax[2] = 1;
+
+	QVector<int> candidates;
+	entry->Index->FindInBox(boxMin, boxMax, candidates);
+
+	vtkFloatArray* xData = vtkFloatArray::SafeDownCast(entry->Data->GetFieldData()->GetArray(0));
+	vtkFloatArray* yData = vtkFloatArray::SafeDownCast(entry->Data->GetFieldData()->GetArray(1));
+	int nearest = -1;
+	double nearestDist = HOVER_TOLERANCE * HOVER_TOLERANCE;
+	for(int i = 0; i < candidates.size(); i++)
+	{
+		int row = entry->IndexRows[candidates[i]];
+		double pu = xData->GetValue(row);
+		double pv = yData->GetValue(row);
+		myPlot->PlotToViewportCoordinate(myPlotRenderer, pu, pv);
+		double dist = (pu - u) * (pu - u) + (pv - v) * (pv - v);
+		if(dist <= nearestDist)
+		{
+			nearest = row;
+			nearestDist = dist;
+		}
+	}
+	if(nearest == -1)
+	{
+		QToolTip::hideText();
+		return;
+	}
+
+	// Describe the sample.
+	DataSet* data = myVizMng->GetDataSet();
+	DataSetInfo* info = data->GetInfo();
+	DataItem* item = data->GetData(nearest, entry->Key.Subset);
+	QString text;
+	if(info->GetTag1Index() != -1)
+	{
+		text += QString("<b>%1: %2</b><br>").arg(QString::fromStdString(info->GetTag1Label())).arg(item->Tag1);
+	}
+	if(item->Timestamp != 0)
+	{
+		text += QDateTime::fromTime_t(item->Timestamp).toString("yyyy-MM-dd hh:mm:ss") + "<br>";
+	}
+	for(int i = 0; i < info->GetNumFields(); i++)
+	{
+		if(i > 0) text += "<br>";
+		text += QString("%1: %2").arg(data->GetFieldName(i)).arg(item->Field[i]);
+	}
+
+	int* size = myPlotRenderWindow->GetSize();
+	QPoint widgetPos(pos[0], size[1] - pos[1] - 1);
+	QToolTip::showText(myUI->vtkView->mapToGlobal(widgetPos), text, myUI->vtkView);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnDataSetChanged(DataSet::ChangeType change, int field)
+{
+	if(change == DataSet::FilteredChanged) InvalidateCache(-1, true, false);
+	else if(change == DataSet::GroupingChanged) InvalidateCache(-1, false, true);
+	else if(change == DataSet::FieldValuesChanged) InvalidateCache(field, true, true);
+	if(change != DataSet::GroupingChanged) myBrushedDataValid = false;
+
+	if(!IsEnabled()) return;
+	// Nothing to redraw if nothing was and is still brushed.
+	if(change == DataSet::BrushChanged && myBrushedData->GetFieldData()->GetArray(0)->GetNumberOfTuples() == 0 &&
+		myVizMng->GetDataSet()->GetNumBrushedRows() == 0) return;
+	if(change == DataSet::FieldValuesChanged && 
+		field != myUI->xAxisBox->currentIndex() && 
+		field != myUI->yAxisBox->currentIndex()) return;
+
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnAxisFieldChanged(int i)
+{
+	QString xAxis = myUI->timeSeriesBox->isChecked() ? QString("Time (days)") : myUI->xAxisBox->currentText();
+	QString yAxis = myUI->yAxisBox->currentText();
+
+	myUI->xRangeLabel->setText(xAxis + " range:");
+	myUI->yRangeLabel->setText(yAxis + " range:");
+	myUI->xTicksLabel->setText(xAxis + " ticks:");
+	myUI->yTicksLabel->setText(yAxis + " ticks:");
+	myUI->xReferenceEnabledBox->setText(xAxis + " reference line");
+	myUI->yReferenceEnabledBox->setText(yAxis + " reference line");
+
+	Update();
+	OnViewAllButtonClicked();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnViewAllButtonClicked()
+{
+	int yField = myUI->yAxisBox->currentIndex();
+	float xr[2];
+	GetXAxisRange(xr);
+	float* yr = myVizMng->GetDataSet()->GetFieldRange(yField);
+
+	// Update the range boxes without triggering OnRangeChanged for each change, then apply the new range once.
+	myUI->xRangeMinBox->blockSignals(true);
+	myUI->xRangeMaxBox->blockSignals(true);
+	myUI->yRangeMinBox->blockSignals(true);
+	myUI->yRangeMaxBox->blockSignals(true);
+
+	myUI->xRangeMinBox->setMinimum(xr[0]);
+	myUI->xRangeMaxBox->setMinimum(xr[0]);
+	myUI->xRangeMinBox->setMaximum(xr[1]);
+	myUI->xRangeMaxBox->setMaximum(xr[1]);
+	myUI->xReferenceBox->setMinimum(xr[0]);
+	myUI->xReferenceBox->setMaximum(xr[1]);
+
+	myUI->yRangeMinBox->setMinimum(yr[0]);
+	myUI->yRangeMaxBox->setMinimum(yr[0]);
+	myUI->yRangeMinBox->setMaximum(yr[1]);
+	myUI->yRangeMaxBox->setMaximum(yr[1]);
+	myUI->yReferenceBox->setMinimum(yr[0]);
+	myUI->yReferenceBox->setMaximum(yr[1]);
+
+	myUI->xRangeMinBox->setValue(xr[0]);
+	myUI->xRangeMaxBox->setValue(xr[1]);
+
+	myUI->yRangeMinBox->setValue(yr[0]);
+	myUI->yRangeMaxBox->setValue(yr[1]);
+
+	myUI->xRangeMinBox->blockSignals(false);
+	myUI->xRangeMaxBox->blockSignals(false);
+	myUI->yRangeMinBox->blockSignals(false);
+	myUI->yRangeMaxBox->blockSignals(false);
+
+	OnRangeChanged();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnRangeChanged()
+{
+	// Time series pick the pyramid level, the visible buckets and the plot X origin from the range.
+	if(myUI->timeSeriesBox->isChecked())
+	{
+		UpdateTimeSeries();
+	}
+	else
+	{
+		myPlot->SetViewRange(
+			myUI->xRangeMinBox->value(), myUI->xRangeMaxBox->value(), 
+			myUI->yRangeMinBox->value(), myUI->yRangeMaxBox->value());
+	}
+
+	//myUI->zoomButton->setChecked(true);
+
+	myPlotRenderWindow->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnExportImageButtonClicked()
+{
+	myVizMng->GetFrameScheduler()->Flush();
+	Utils::SaveScreenshot(myPlotRenderWindow);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnDensityModeChanged()
+{
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+
+	// The plot bins the visible range again whenever the plot range changes, so zoom and pan need 
+	// no special handling here.
+	myPlot->SetDensityMode(myUI->densityBox->isChecked());
+	myPlot->SetDensityColorFunction(prefs->GetPlotColorTransferFunction());
+	myUI->groupOverlayBox->setEnabled(myUI->densityBox->isChecked());
+
+	if(myCurrentEntry == NULL)
+	{
+		Update();
+		return;
+	}
+	UpdatePlotInputs();
+	myPlotRenderWindow->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnTimeSeriesModeChanged()
+{
+	bool timeSeries = myUI->timeSeriesBox->isChecked();
+	myUI->xAxisBox->setEnabled(!timeSeries);
+	// Time ranges are in days: use more decimals, so that the range can be zoomed down to single samples.
+	myUI->xRangeMinBox->setDecimals(timeSeries ? 5 : 2);
+	myUI->xRangeMaxBox->setDecimals(timeSeries ? 5 : 2);
+	myUI->xReferenceBox->setDecimals(timeSeries ? 5 : 2);
+	OnAxisFieldChanged(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnReferenceLinesChanged()
+{
+	// Reference lines do not depend on the plot data: just reassemble the plot inputs.
+	if(myCurrentEntry == NULL)
+	{
+		Update();
+		return;
+	}
+	UpdatePlotInputs();
+	myPlotRenderWindow->Render();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PlotView::OnLegendPositionChanged()
+{
+	SetPlotProperties();
 }
\ No newline at end of file
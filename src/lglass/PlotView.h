@@ -1,86 +1,163 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#ifndef PLOTVIEW_H
-#define PLOTVIEW_H
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-#include "LookingGlassSystem.h"
-#include "DataSet.h"
-#include "DockedTool.h"
-#include "ui_PlotViewDock.h"
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-class PlotView: public DockedTool
-{
-	Q_OBJECT
-public:
-    /////////////////////////////////////////////////////// Ctor / Dtor.
-    PlotView(VisualizationManager* msg, int index);
-    ~PlotView();
-
-    /////////////////////////////////////////////////////// Other Methods.
-    void Initialize();
-    void Update();
-	void Render();
-    
-	void OnSelectionChanged(int* sel);
-
-protected slots:
-    void OnAxisFieldChanged(int i);
-	void OnViewAllButtonClicked();
-	void OnExportImageButtonClicked();
-	void OnReferenceLinesChanged();
-	void OnRangeChanged();
-	void OnLegendPositionChanged();
-	void SetPlotProperties();
-
-private:
-	void SetupUI();
-	void AddReferenceLine(int c, float x1, float y1, float x2, float y2, QString name, float value);
-
-private:
-	// UI.
-	Ui_PlotViewDock* myUI;
-	VisualizationManager* myVizMng;
-
-    // Plot stuff.
-    Plot* myPlot;
-    vtkRenderWindow* myPlotRenderWindow;
-    vtkRenderer* myPlotRenderer;
-    vtkAttributeDataToFieldDataFilter* myPlotDataFilter;
-	vtkInteractorStyleRubberBand2D* myInteractorStyle;
-
-	// Filters
-	static DynamicFilter* myXFilter;
-	static DynamicFilter* myYFilter;
-};
-
-#endif 
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef PLOTVIEW_H
+#define PLOTVIEW_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+#include "DockedTool.h"
+#include "ui_PlotViewDock.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class PlotView: public DockedTool, public DataSetListener
+{
+	Q_OBJECT
+public:
+	// Maximum number of cached plot data sets (one for each axis field, subset and grouping combination).
+	static const int MAX_CACHE_ENTRIES = 4;
+	// Maximum distance (in pixels) from the mouse of the point shown by hover inspection.
+	static const int HOVER_TOLERANCE = 6;
+	// Maximum number of samples or time buckets drawn by time series plots.
+	static const int MAX_TIME_SERIES_POINTS = 2000;
+	static const int SECONDS_PER_DAY = 86400;
+
+public:
+    /////////////////////////////////////////////////////// Ctor / Dtor.
+    PlotView(VisualizationManager* msg, int index);
+    ~PlotView();
+
+    /////////////////////////////////////////////////////// Other Methods.
+    void Initialize();
+    void Update();
+	void Render();
+    
+	void OnSelectionChanged(int* sel);
+	void OnMouseMove();
+	// Plots depend on the filtered data, the data groups, the brushes and the values of the plotted fields.
+	void OnDataSetChanged(DataSet::ChangeType change, int field);
+
+protected slots:
+    void OnAxisFieldChanged(int i);
+	void OnViewAllButtonClicked();
+	void OnExportImageButtonClicked();
+	void OnReferenceLinesChanged();
+	void OnRangeChanged();
+	void OnLegendPositionChanged();
+	void OnDensityModeChanged();
+	void OnTimeSeriesModeChanged();
+	void SetPlotProperties();
+
+private:
+	struct PlotCacheKey
+	{
+		int XField;
+		int YField;
+		DataSet::SubsetType Subset;
+		DataSetInfo::TagId GroupingTagId;
+		DataSet::SubsetType GroupingSubset;
+
+		bool operator==(const PlotCacheKey& k) const
+		{
+			return XField == k.XField && YField == k.YField && Subset == k.Subset && 
+				GroupingTagId == k.GroupingTagId && GroupingSubset == k.GroupingSubset;
+		}
+	};
+
+	// Cached plot inputs. The subset data and the group data are invalidated and refilled separately.
+	// All groups are stored in a single data object, with a group index column.
+	struct PlotCacheEntry
+	{
+		PlotCacheKey Key;
+		vtkDataObject* Data;
+		vtkDataObject* GroupData;
+		QVector<QString> GroupLabels;
+		// Hover index over the subset data, in plot space normalized to the field ranges. IndexRows 
+		// maps index point ids to subset rows.
+		SpatialIndex* Index;
+		QVector<int> IndexRows;
+		float IndexMin[2];
+		float IndexScale[2];
+		bool DataValid;
+		bool GroupsValid;
+		bool IndexValid;
+	};
+
+private:
+	void SetupUI();
+	void AddReferenceLine(int c, float x1, float y1, float x2, float y2, QString name, float value);
+
+	// Plot data cache management.
+	PlotCacheEntry* GetCacheEntry(const PlotCacheKey& key);
+	void DeleteCacheEntry(PlotCacheEntry* entry);
+	// Invalidates the cache entries using the specified field (or all entries if field is -1).
+	void InvalidateCache(int field, bool data, bool groups);
+	void UpdateCacheData(PlotCacheEntry* entry);
+	void UpdateCacheGroups(PlotCacheEntry* entry);
+	void UpdateCacheIndex(PlotCacheEntry* entry);
+	void UpdateBrushedData();
+	// In time series mode, the Y axis field is plotted against time in days. The range boxes are in days since the 
+	// first dataset sample, while plot X coordinates are relative to the start of the visible span, to keep sample 
+	// times exact in floats. Also sets the plot view range from the range boxes.
+	void UpdateTimeSeries();
+	void GetXAxisRange(float range[2]);
+	void UpdatePlotInputs();
+	vtkDataObject* NewPlotData(bool grouped = false);
+	void ResizePlotData(vtkDataObject* dataObject, int length, float** x, float** y, int** groups = NULL);
+
+private:
+	// UI.
+	Ui_PlotViewDock* myUI;
+	VisualizationManager* myVizMng;
+
+    // Plot stuff.
+    Plot* myPlot;
+    vtkRenderWindow* myPlotRenderWindow;
+    vtkRenderer* myPlotRenderer;
+    vtkAttributeDataToFieldDataFilter* myPlotDataFilter;
+	vtkInteractorStyleRubberBand2D* myInteractorStyle;
+
+	// Plot data cache, most recently used entries first.
+	QList<PlotCacheEntry*> myCache;
+	PlotCacheEntry* myCurrentEntry;
+	vtkDataObject* myReferenceData[2];
+	// Time series mean, minimum and maximum lines (only the first one is used at full resolution).
+	vtkDataObject* myTimeSeriesData[3];
+	// Days between the first dataset sample and the time series plot X origin.
+	double myTimeSeriesOffset;
+
+	// Brushing. Each plot view owns its brush; the rows inside all the dataset brushes are highlighted.
+	DataBrush* myBrush;
+	vtkDataObject* myBrushedData;
+	bool myBrushedDataValid;
+};
+
+#endif 
@@ -0,0 +1,289 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "PointOctree.h"
+
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkIdTypeArray.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkRenderer.h>
+
+#include <float.h>
+#include <queue>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+PointOctree::PointOctree()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+PointOctree::~PointOctree()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PointOctree::Build(const float* points, int numPoints)
+{
+	myNodes.clear();
+	myIds.resize(numPoints);
+	if(numPoints == 0) return;
+
+	// Root node is the bounding cube of the point cloud.
+	float bmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	float bmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for(int i = 0; i < numPoints; i++)
+	{
+		myIds[i] = i;
+		for(int j = 0; j < 3; j++)
+		{
+			float v = points[i * 3 + j];
+			if(v < bmin[j]) bmin[j] = v;
+			if(v > bmax[j]) bmax[j] = v;
+		}
+	}
+
+	Node root;
+	root.HalfSize = 0;
+	for(int j = 0; j < 3; j++)
+	{
+		root.Center[j] = (bmin[j] + bmax[j]) / 2;
+		root.HalfSize = qMax(root.HalfSize, (bmax[j] - bmin[j]) / 2);
+	}
+	root.Start = 0;
+	root.Count = numPoints;
+	root.Depth = 0;
+	root.FirstChild = -1;
+	myNodes.push_back(root);
+
+	// Split nodes breadth first. Children are appended to the node list, so the loop visits them too.
+	int* buffer = new int[numPoints];
+	for(int i = 0; i < myNodes.size(); i++)
+	{
+		if(myNodes[i].Count > MAX_LEAF_SIZE && myNodes[i].Depth < MAX_DEPTH && myNodes[i].HalfSize > 0)
+		{
+			Split(i, points, buffer);
+		}
+	}
+	delete[] buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PointOctree::Split(int nodeIndex, const float* points, int* buffer)
+{
+	Node node = myNodes[nodeIndex];
+
+	// Count the points in each octant.
+	int counts[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+	for(int k = node.Start; k < node.Start + node.Count; k++)
+	{
+		const float* p = &points[myIds[k] * 3];
+		int octant = (p[0] >= node.Center[0] ? 1 : 0) | (p[1] >= node.Center[1] ? 2 : 0) | (p[2] >= node.Center[2] ? 4 : 0);
+		counts[octant]++;
+	}
+
+	// Partition the node range so each child gets a contiguous sub range.
+	int offsets[8];
+	offsets[0] = 0;
+	for(int o = 1; o < 8; o++) offsets[o] = offsets[o - 1] + counts[o - 1];
+
+	int fill[8];
+	memcpy(fill, offsets, sizeof(fill));
+	for(int k = node.Start; k < node.Start + node.Count; k++)
+	{
+		int id = myIds[k];
+		const float* p = &points[id * 3];
+		int octant = (p[0] >= node.Center[0] ? 1 : 0) | (p[1] >= node.Center[1] ? 2 : 0) | (p[2] >= node.Center[2] ? 4 : 0);
+		buffer[fill[octant]++] = id;
+	}
+	memcpy(&myIds[node.Start], buffer, sizeof(int) * node.Count);
+
+	int firstChild = myNodes.size();
+	float h = node.HalfSize / 2;
+	for(int o = 0; o < 8; o++)
+	{
+		Node child;
+		child.Center[0] = node.Center[0] + ((o & 1) ? h : -h);
+		child.Center[1] = node.Center[1] + ((o & 2) ? h : -h);
+		child.Center[2] = node.Center[2] + ((o & 4) ? h : -h);
+		child.HalfSize = h;
+		child.Start = node.Start + offsets[o];
+		child.Count = counts[o];
+		child.Depth = node.Depth + 1;
+		child.FirstChild = -1;
+		myNodes.push_back(child);
+	}
+	myNodes[nodeIndex].FirstChild = firstChild;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int PointOctree::Select(vtkRenderer* renderer, vtkActor* actor, const unsigned char* mask, unsigned char bit, 
+	int budget, bool cull, vtkIdTypeArray* verts, bool* complete)
+{
+	verts->Reset();
+	*complete = true;
+	if(myNodes.size() == 0) return 0;
+
+	// Gather view information: actor transform, camera parameters and frustum planes, all used to
+	// compute node screen sizes and visibility.
+	vtkCamera* camera = renderer->GetActiveCamera();
+	int* size = renderer->GetSize();
+
+	// viewInfo layout: 16 matrix values, max actor scale, parallel flag, parallel scale, view angle,
+	// viewport height, camera position (3).
+	double viewInfo[25];
+	vtkMatrix4x4* m = actor->GetMatrix();
+	for(int i = 0; i < 16; i++) viewInfo[i] = m->Element[i / 4][i % 4];
+	double* scale = actor->GetScale();
+	viewInfo[16] = qMax(qMax(fabs(scale[0]), fabs(scale[1])), fabs(scale[2]));
+	viewInfo[17] = camera->GetParallelProjection() ? 1 : 0;
+	viewInfo[18] = camera->GetParallelScale();
+	viewInfo[19] = camera->GetViewAngle() * vtkMath::Pi() / 180;
+	viewInfo[20] = size[1];
+	camera->GetPosition(&viewInfo[21]);
+
+	double planes[24];
+	camera->GetFrustumPlanes(renderer->GetTiledAspectRatio(), planes);
+
+	// Refine the largest nodes first.
+	std::priority_queue< std::pair<float, int> > queue;
+	queue.push(std::pair<float, int>(GetPixelSize(myNodes[0], viewInfo), 0));
+
+	int selected = 0;
+	while(!queue.empty())
+	{
+		float pixels = queue.top().first;
+		const Node& node = myNodes[queue.top().second];
+		queue.pop();
+
+		if(node.Count == 0 || (cull && !IsVisible(node, viewInfo, planes))) continue;
+
+		if(selected >= budget)
+		{
+			// Out of budget: draw a coarse representation of the node.
+			selected += EmitPoints(node, COARSE_SAMPLE_SIZE, mask, bit, verts);
+			*complete = false;
+		}
+		else if(node.FirstChild == -1)
+		{
+			selected += EmitPoints(node, node.Count, mask, bit, verts);
+		}
+		else if(pixels < MIN_NODE_PIXELS)
+		{
+			// Node is small on screen: about one point per pixel is enough.
+			int count = qMax(1, (int)(pixels * pixels));
+			selected += EmitPoints(node, count, mask, bit, verts);
+		}
+		else
+		{
+			for(int c = 0; c < 8; c++)
+			{
+				int childIndex = node.FirstChild + c;
+				if(myNodes[childIndex].Count > 0)
+				{
+					queue.push(std::pair<float, int>(GetPixelSize(myNodes[childIndex], viewInfo), childIndex));
+				}
+			}
+		}
+	}
+	return selected;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void PointOctree::GetWorldSphere(const Node& node, double* viewInfo, double* center, double* radius)
+{
+	// Transform the node bounding sphere by the actor matrix. Using the largest actor scale keeps 
+	// the sphere conservative when the depth scale stretches one axis.
+	double* m = viewInfo;
+	for(int i = 0; i < 3; i++)
+	{
+		center[i] = m[i * 4] * node.Center[0] + m[i * 4 + 1] * node.Center[1] + m[i * 4 + 2] * node.Center[2] + m[i * 4 + 3];
+	}
+	*radius = node.HalfSize * 1.7320508 * viewInfo[16];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float PointOctree::GetPixelSize(const Node& node, double* viewInfo)
+{
+	double c[3];
+	double radius;
+	GetWorldSphere(node, viewInfo, c, &radius);
+	double viewportHeight = viewInfo[20];
+
+	if(viewInfo[17] != 0)
+	{
+		// Parallel projection: size does not depend on distance.
+		return (float)(radius * viewportHeight / viewInfo[18]);
+	}
+
+	double dx = c[0] - viewInfo[21];
+	double dy = c[1] - viewInfo[22];
+	double dz = c[2] - viewInfo[23];
+	double dist = sqrt(dx * dx + dy * dy + dz * dz);
+
+	// Camera inside the node: make sure it gets refined.
+	if(dist <= radius) return FLT_MAX;
+	return (float)(radius / (dist * tan(viewInfo[19] / 2)) * viewportHeight / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool PointOctree::IsVisible(const Node& node, double* viewInfo, double* planes)
+{
+	double c[3];
+	double radius;
+	GetWorldSphere(node, viewInfo, c, &radius);
+
+	// Frustum planes point inwards.
+	for(int i = 0; i < 6; i++)
+	{
+		double* p = &planes[i * 4];
+		if(p[0] * c[0] + p[1] * c[1] + p[2] * c[2] + p[3] < -radius) return false;
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int PointOctree::EmitPoints(const Node& node, int count, const unsigned char* mask, unsigned char bit, vtkIdTypeArray* verts)
+{
+	int step = count >= node.Count ? 1 : node.Count / count;
+	int emitted = 0;
+	for(int k = node.Start; k < node.Start + node.Count; k += step)
+	{
+		int id = myIds[k];
+		if(mask[id] & bit)
+		{
+			verts->InsertNextValue(1);
+			verts->InsertNextValue(id);
+			emitted++;
+		}
+	}
+	return emitted;
+}
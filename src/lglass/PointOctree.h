@@ -0,0 +1,97 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef POINTOCTREE_H
+#define POINTOCTREE_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+
+#include <QVector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// An octree over a point cloud, used to select a view dependent level of detail. Each node owns a
+// contiguous range of point ids that covers its whole subtree, so a coarse representation of any
+// node can be obtained by sampling its range with a stride.
+class PointOctree
+{
+public:
+	// Maximum number of points stored in a leaf node.
+	static const int MAX_LEAF_SIZE = 256;
+	// Maximum depth of the tree.
+	static const int MAX_DEPTH = 16;
+	// Nodes smaller than this on screen (in pixels) are drawn using a sample of their points.
+	static const int MIN_NODE_PIXELS = 8;
+	// Number of points used to draw a node that does not fit in the point budget.
+	static const int COARSE_SAMPLE_SIZE = 16;
+
+public:
+	// Ctor / Dtor.
+	PointOctree();
+	~PointOctree();
+
+	// Builds the octree over numPoints positions, stored as consecutive x, y, z triples.
+	void Build(const float* points, int numPoints);
+
+	// Selects the points to draw for the current view of the specified actor, and writes them to 
+	// verts as vertex cell connectivity. Only points whose mask has the specified bit set are drawn. 
+	// Nodes are refined largest first until budget points have been selected; the remaining nodes 
+	// are drawn coarsely. If cull is false nodes outside of the view frustum are kept, so the 
+	// selection stays usable while the camera moves. Returns the number of selected points and sets
+	// complete to false if some nodes were drawn coarsely because of the budget.
+	int Select(vtkRenderer* renderer, vtkActor* actor, const unsigned char* mask, unsigned char bit, 
+		int budget, bool cull, vtkIdTypeArray* verts, bool* complete);
+
+	int GetNumPoints() { return myIds.size(); }
+
+private:
+	struct Node
+	{
+		float Center[3];
+		float HalfSize;
+		int Start;
+		int Count;
+		int Depth;
+		// Index of the first of 8 consecutive child nodes, -1 for leaves.
+		int FirstChild;
+	};
+
+	void Split(int nodeIndex, const float* points, int* buffer);
+	void GetWorldSphere(const Node& node, double* viewInfo, double* center, double* radius);
+	float GetPixelSize(const Node& node, double* viewInfo);
+	bool IsVisible(const Node& node, double* viewInfo, double* planes);
+	int EmitPoints(const Node& node, int count, const unsigned char* mask, unsigned char bit, vtkIdTypeArray* verts);
+
+private:
+	QVector<Node> myNodes;
+	QVector<int> myIds;
+};
+
+#endif
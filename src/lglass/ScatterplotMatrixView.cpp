@@ -0,0 +1,241 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "AppConfig.h"
+#include "ScatterplotMatrixView.h"
+#include "DensityBinner.h"
+#include "Preferences.h"
+#include "VisualizationManager.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QPixmap>
+
+#include <vtkColorTransferFunction.h>
+
+#include <math.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ScatterplotMatrixView::ScatterplotMatrixView(VisualizationManager* mng): 
+	DockedTool(mng, "Scatterplot Matrix", Qt::RightDockWidgetArea),
+	myVizMng(mng),
+	myBins(0)
+{
+	GetMenuAction()->setIcon(QIcon(":/icons/PlotView.png"));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+ScatterplotMatrixView::~ScatterplotMatrixView()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::Initialize()
+{
+	myVizMng->GetDataSet()->AddListener(this, 
+		DataSet::FilteredChanged | DataSet::FieldValuesChanged | DataSet::FieldRangeChanged);
+
+	SetupUI();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::SetupUI()
+{
+	DataSet* data = myVizMng->GetDataSet();
+
+	myUI = new Ui_ScatterplotMatrixDock();
+	myUI->setupUi(GetDockWidget());
+
+	for(int i = 0; i < data->GetInfo()->GetNumFields(); i++)
+	{
+		QListWidgetItem* item = new QListWidgetItem(data->GetFieldName(i), myUI->fieldList);
+		item->setFlags(item->flags() | Qt::ItemIsUserCheckable);
+		item->setCheckState(i < DEFAULT_FIELDS ? Qt::Checked : Qt::Unchecked);
+	}
+
+	connect(myUI->fieldList, SIGNAL(itemChanged(QListWidgetItem*)), SLOT(OnFieldsChanged()));
+	connect(myUI->binsBox, SIGNAL(valueChanged(int)), SLOT(OnBinsChanged()));
+	connect(myUI->cellSizeBox, SIGNAL(valueChanged(int)), SLOT(OnCellSizeChanged()));
+	connect(GetDockWidget(), SIGNAL(visibilityChanged(bool)), SLOT(OnVisibilityChanged(bool)));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::Update()
+{
+	DataSet* data = myVizMng->GetDataSet();
+
+	myFields.clear();
+	for(int i = 0; i < myUI->fieldList->count(); i++)
+	{
+		if(myUI->fieldList->item(i)->checkState() == Qt::Checked) myFields.append(i);
+	}
+	int numFields = myFields.size();
+	myBins = myUI->binsBox->value();
+
+	// Bin all the field pairs over the filtered rows, reading the dataset columns directly.
+	QVector<const float*> columns(numFields);
+	QVector<double> ranges(numFields * 2);
+	for(int i = 0; i < numFields; i++)
+	{
+		float* range = data->GetFieldRange(myFields[i]);
+		columns[i] = data->GetFieldColumn(myFields[i]);
+		ranges[i * 2] = range[0];
+		ranges[i * 2 + 1] = range[1];
+	}
+	myCounts.resize(numFields * (numFields - 1) / 2 * myBins * myBins);
+	if(numFields > 1) DensityBinner::BinPairs(columns.data(), numFields, data->GetMaskBuffer(), DataSet::MaskFiltered,
+		data->GetDataLength(DataSet::AllData), ranges.data(), myBins, myCounts.data());
+
+	DrawMatrix();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::Render()
+{
+	// The matrix is a Qt image, there is no render window to refresh.
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::DrawMatrix()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	Preferences* prefs = AppConfig::GetInstance()->GetPreferences();
+	int numFields = myFields.size();
+	int cellSize = myUI->cellSizeBox->value();
+	if(numFields < 2)
+	{
+		myUI->matrixLabel->setText("Select at least two fields.");
+		return;
+	}
+
+	// Sample the plot color function once. Counts are log scaled, like in the plot density mode.
+	double table[256 * 3];
+	prefs->GetPlotColorTransferFunction()->GetTable(0.0, 1.0, 256, table);
+	QRgb colors[256];
+	for(int i = 0; i < 256; i++)
+	{
+		colors[i] = qRgb((int)(table[i * 3] * 255), (int)(table[i * 3 + 1] * 255), (int)(table[i * 3 + 2] * 255));
+	}
+	QColor background = prefs->GetPlotBackgroundColor();
+	QColor foreground = prefs->GetPlotForegroundColor();
+
+	QImage matrix(numFields * cellSize, numFields * cellSize, QImage::Format_RGB32);
+	matrix.fill(background.rgb());
+	QPainter painter(&matrix);
+	QImage cell(myBins, myBins, QImage::Format_RGB32);
+	int pairBins = myBins * myBins;
+	for(int r = 0; r < numFields; r++)
+	{
+		for(int c = 0; c < numFields; c++)
+		{
+			QRect cellRect(c * cellSize, r * cellSize, cellSize, cellSize);
+			if(r == c)
+			{
+				painter.setPen(foreground);
+				painter.drawText(cellRect, Qt::AlignCenter | Qt::TextWordWrap, data->GetFieldName(myFields[r]));
+				continue;
+			}
+
+			// Cells show the column field along x and the row field along y. Histograms are only stored for 
+			// one of the two symmetric pairs, so the cells above the diagonal are transposed.
+			bool transpose = c > r;
+			const unsigned int* counts = myCounts.constData() + 
+				DensityBinner::GetPairIndex(qMin(r, c), qMax(r, c), numFields) * pairBins;
+			unsigned int maxCount = 0;
+			for(int i = 0; i < pairBins; i++) if(counts[i] > maxCount) maxCount = counts[i];
+			double scale = maxCount > 0 ? 255.0 / log(1.0 + maxCount) : 0;
+
+			for(int y = 0; y < myBins; y++)
+			{
+				// Image rows go top to bottom, histogram rows go from the minimum y.
+				QRgb* line = reinterpret_cast<QRgb*>(cell.scanLine(myBins - 1 - y));
+				for(int x = 0; x < myBins; x++)
+				{
+					unsigned int count = transpose ? counts[x * myBins + y] : counts[y * myBins + x];
+					if(count == 0)
+					{
+						line[x] = background.rgb();
+					}
+					else
+					{
+						int t = (int)(log(1.0 + count) * scale);
+						line[x] = colors[t > 255 ? 255 : t];
+					}
+				}
+			}
+			painter.drawImage(cellRect, cell);
+		}
+	}
+
+	// Cell borders.
+	painter.setPen(foreground);
+	for(int i = 1; i < numFields; i++)
+	{
+		painter.drawLine(i * cellSize, 0, i * cellSize, numFields * cellSize);
+		painter.drawLine(0, i * cellSize, numFields * cellSize, i * cellSize);
+	}
+	painter.end();
+
+	myUI->matrixLabel->setPixmap(QPixmap::fromImage(matrix));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::OnDataSetChanged(DataSet::ChangeType change, int field)
+{
+	if(!IsEnabled()) return;
+	if(change != DataSet::FilteredChanged && !myFields.contains(field)) return;
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::OnFieldsChanged()
+{
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::OnBinsChanged()
+{
+	myVizMng->RequestUpdate(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::OnCellSizeChanged()
+{
+	// The histograms do not depend on the cell size.
+	if(myBins > 0) DrawMatrix();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ScatterplotMatrixView::OnVisibilityChanged(bool visible)
+{
+	// The matrix is not kept up to date while hidden.
+	if(visible) myVizMng->RequestUpdate(this);
+}
@@ -0,0 +1,84 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef SCATTERPLOTMATRIXVIEW_H
+#define SCATTERPLOTMATRIXVIEW_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+#include "DockedTool.h"
+#include "ui_ScatterplotMatrixDock.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Shows every pair among a set of fields as small density plots. All the pair histograms are binned 
+// together, in a single multithreaded pass over the filtered rows (see DensityBinner::BinPairs).
+class ScatterplotMatrixView: public DockedTool, public DataSetListener
+{
+	Q_OBJECT
+public:
+	// Number of fields shown by default.
+	static const int DEFAULT_FIELDS = 4;
+
+public:
+    /////////////////////////////////////////////////////// Ctor / Dtor.
+    ScatterplotMatrixView(VisualizationManager* mng);
+    ~ScatterplotMatrixView();
+
+    /////////////////////////////////////////////////////// Other Methods.
+    void Initialize();
+    void Update();
+	void Render();
+	// The matrix depends on the filtered data and on the values and ranges of the shown fields.
+	void OnDataSetChanged(DataSet::ChangeType change, int field);
+
+protected slots:
+	void OnFieldsChanged();
+	void OnBinsChanged();
+	void OnCellSizeChanged();
+	void OnVisibilityChanged(bool visible);
+
+private:
+	void SetupUI();
+	// Draws the matrix image from the current histograms.
+	void DrawMatrix();
+
+private:
+	// UI.
+	Ui_ScatterplotMatrixDock* myUI;
+	VisualizationManager* myVizMng;
+
+	// Shown fields and their pair histograms, as returned by DensityBinner::BinPairs.
+	QVector<int> myFields;
+	QVector<unsigned int> myCounts;
+	int myBins;
+};
+
+#endif
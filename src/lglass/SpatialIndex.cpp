@@ -0,0 +1,321 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "SpatialIndex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+SpatialIndex::SpatialIndex():
+	myNumPoints(0),
+	myNumCells(0),
+	myCellStart(NULL),
+	myIds(NULL),
+	myPoints(NULL)
+{
+	for(int i = 0; i < 3; i++)
+	{
+		myMin[i] = 0;
+		myMax[i] = 0;
+		myCellSize[i] = 1;
+		myResolution[i] = 1;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+SpatialIndex::~SpatialIndex()
+{
+	Clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void SpatialIndex::Clear()
+{
+	delete[] myCellStart;
+	delete[] myIds;
+	delete[] myPoints;
+	myCellStart = NULL;
+	myIds = NULL;
+	myPoints = NULL;
+	myNumPoints = 0;
+	myNumCells = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void SpatialIndex::Build(const float* points, int numPoints)
+{
+	Clear();
+	if(numPoints <= 0) return;
+
+	myNumPoints = numPoints;
+
+	// Compute bounds.
+	for(int j = 0; j < 3; j++)
+	{
+		myMin[j] = FLT_MAX;
+		myMax[j] = -FLT_MAX;
+	}
+	for(int i = 0; i < numPoints; i++)
+	{
+		const float* p = &points[i * 3];
+		for(int j = 0; j < 3; j++)
+		{
+			if(p[j] < myMin[j]) myMin[j] = p[j];
+			if(p[j] > myMax[j]) myMax[j] = p[j];
+		}
+	}
+
+	// Choose a cell size that gives roughly POINTS_PER_CELL points per cell, considering only the 
+	// axes that have a non-zero extent.
+	int targetCells = numPoints / POINTS_PER_CELL;
+	if(targetCells < 1) targetCells = 1;
+
+	double volume = 1;
+	int dims = 0;
+	for(int j = 0; j < 3; j++)
+	{
+		float extent = myMax[j] - myMin[j];
+		if(extent > 0)
+		{
+			volume *= extent;
+			dims++;
+		}
+	}
+
+	double cellSize = dims > 0 ? pow(volume / targetCells, 1.0 / dims) : 1;
+	myNumCells = 1;
+	for(int j = 0; j < 3; j++)
+	{
+		float extent = myMax[j] - myMin[j];
+		if(extent > 0 && cellSize > 0)
+		{
+			int res = (int)ceil(extent / cellSize);
+			if(res < 1) res = 1;
+			if(res > MAX_AXIS_RESOLUTION) res = MAX_AXIS_RESOLUTION;
+			myResolution[j] = res;
+			myCellSize[j] = extent / res;
+		}
+		else
+		{
+			myResolution[j] = 1;
+			myCellSize[j] = 1;
+		}
+		myNumCells *= myResolution[j];
+	}
+
+	// Bucket the points using a counting sort on the cell index.
+	int* pointCell = new int[numPoints];
+	myCellStart = new int[myNumCells + 1];
+	memset(myCellStart, 0, sizeof(int) * (myNumCells + 1));
+
+	for(int i = 0; i < numPoints; i++)
+	{
+		const float* p = &points[i * 3];
+		int cell = GetCellIndex(GetCellCoord(p[0], 0), GetCellCoord(p[1], 1), GetCellCoord(p[2], 2));
+		pointCell[i] = cell;
+		myCellStart[cell + 1]++;
+	}
+	for(int i = 0; i < myNumCells; i++)
+	{
+		myCellStart[i + 1] += myCellStart[i];
+	}
+
+	myIds = new int[numPoints];
+	myPoints = new float[numPoints * 3];
+	int* cellFill = new int[myNumCells];
+	memcpy(cellFill, myCellStart, sizeof(int) * myNumCells);
+	for(int i = 0; i < numPoints; i++)
+	{
+		int slot = cellFill[pointCell[i]]++;
+		myIds[slot] = i;
+		myPoints[slot * 3] = points[i * 3];
+		myPoints[slot * 3 + 1] = points[i * 3 + 1];
+		myPoints[slot * 3 + 2] = points[i * 3 + 2];
+	}
+
+	delete[] cellFill;
+	delete[] pointCell;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int SpatialIndex::GetCellCoord(float value, int axis)
+{
+	int c = (int)((value - myMin[axis]) / myCellSize[axis]);
+	if(c < 0) return 0;
+	if(c >= myResolution[axis]) return myResolution[axis] - 1;
+	return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int SpatialIndex::FindNearest(float x, float y, float z, float maxDistance)
+{
+	if(myNumPoints == 0) return -1;
+
+	int c[3];
+	c[0] = GetCellCoord(x, 0);
+	c[1] = GetCellCoord(y, 1);
+	c[2] = GetCellCoord(z, 2);
+
+	// Points outside a ring of r cells around the query cell are at least r * minCellSize away.
+	float minCellSize = FLT_MAX;
+	int maxRing = 0;
+	for(int j = 0; j < 3; j++)
+	{
+		if(myResolution[j] > 1 && myCellSize[j] < minCellSize) minCellSize = myCellSize[j];
+		if(myResolution[j] > maxRing) maxRing = myResolution[j];
+	}
+
+	float bestDist2 = maxDistance < FLT_MAX ? maxDistance * maxDistance : FLT_MAX;
+	int best = -1;
+
+	for(int r = 0; r <= maxRing; r++)
+	{
+		int lo[3], hi[3];
+		for(int j = 0; j < 3; j++)
+		{
+			lo[j] = c[j] - r < 0 ? 0 : c[j] - r;
+			hi[j] = c[j] + r >= myResolution[j] ? myResolution[j] - 1 : c[j] + r;
+		}
+
+		for(int cz = lo[2]; cz <= hi[2]; cz++)
+		{
+			for(int cy = lo[1]; cy <= hi[1]; cy++)
+			{
+				for(int cx = lo[0]; cx <= hi[0]; cx++)
+				{
+					// Skip cells already visited in the previous rings.
+					if(abs(cx - c[0]) < r && abs(cy - c[1]) < r && abs(cz - c[2]) < r) continue;
+
+					int cell = GetCellIndex(cx, cy, cz);
+					for(int k = myCellStart[cell]; k < myCellStart[cell + 1]; k++)
+					{
+						float dx = myPoints[k * 3] - x;
+						float dy = myPoints[k * 3 + 1] - y;
+						float dz = myPoints[k * 3 + 2] - z;
+						float d2 = dx * dx + dy * dy + dz * dz;
+						if(d2 <= bestDist2)
+						{
+							bestDist2 = d2;
+							best = myIds[k];
+						}
+					}
+				}
+			}
+		}
+
+		// Stop when no unvisited cell can contain a closer point.
+		if(minCellSize == FLT_MAX) break;
+		float ringDist = r * minCellSize;
+		if(ringDist * ringDist >= bestDist2) break;
+	}
+	return best;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int SpatialIndex::FindInRadius(float x, float y, float z, float radius, QVector<int>& result)
+{
+	float boxMin[3] = { x - radius, y - radius, z - radius };
+	float boxMax[3] = { x + radius, y + radius, z + radius };
+	float r2 = radius * radius;
+	int found = 0;
+
+	if(myNumPoints == 0) return 0;
+
+	int lo[3], hi[3];
+	for(int j = 0; j < 3; j++)
+	{
+		lo[j] = GetCellCoord(boxMin[j], j);
+		hi[j] = GetCellCoord(boxMax[j], j);
+	}
+
+	for(int cz = lo[2]; cz <= hi[2]; cz++)
+	{
+		for(int cy = lo[1]; cy <= hi[1]; cy++)
+		{
+			for(int cx = lo[0]; cx <= hi[0]; cx++)
+			{
+				int cell = GetCellIndex(cx, cy, cz);
+				for(int k = myCellStart[cell]; k < myCellStart[cell + 1]; k++)
+				{
+					float dx = myPoints[k * 3] - x;
+					float dy = myPoints[k * 3 + 1] - y;
+					float dz = myPoints[k * 3 + 2] - z;
+					if(dx * dx + dy * dy + dz * dz <= r2)
+					{
+						result.push_back(myIds[k]);
+						found++;
+					}
+				}
+			}
+		}
+	}
+	return found;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int SpatialIndex::FindInBox(const float* boxMin, const float* boxMax, QVector<int>& result)
+{
+	int found = 0;
+
+	if(myNumPoints == 0) return 0;
+
+	int lo[3], hi[3];
+	for(int j = 0; j < 3; j++)
+	{
+		// Empty query box or box completely outside the grid.
+		if(boxMin[j] > boxMax[j] || boxMax[j] < myMin[j] || boxMin[j] > myMax[j]) return 0;
+		lo[j] = GetCellCoord(boxMin[j], j);
+		hi[j] = GetCellCoord(boxMax[j], j);
+	}
+
+	for(int cz = lo[2]; cz <= hi[2]; cz++)
+	{
+		for(int cy = lo[1]; cy <= hi[1]; cy++)
+		{
+			for(int cx = lo[0]; cx <= hi[0]; cx++)
+			{
+				int cell = GetCellIndex(cx, cy, cz);
+				for(int k = myCellStart[cell]; k < myCellStart[cell + 1]; k++)
+				{
+					const float* p = &myPoints[k * 3];
+					if(p[0] >= boxMin[0] && p[0] <= boxMax[0] &&
+						p[1] >= boxMin[1] && p[1] <= boxMax[1] &&
+						p[2] >= boxMin[2] && p[2] <= boxMax[2])
+					{
+						result.push_back(myIds[k]);
+						found++;
+					}
+				}
+			}
+		}
+	}
+	return found;
+}
@@ -0,0 +1,93 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+
+#include <float.h>
+#include <QVector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// A uniform grid index over a set of 3D positions. Point ids returned by queries are indices into
+// the position array passed to Build(). Degenerate axes (i.e. all z values set to 0) are collapsed 
+// to a single cell, so the same class can be used to index 2D plot coordinates.
+class SpatialIndex
+{
+public:
+	// Average number of points per grid cell the index tries to keep.
+	static const int POINTS_PER_CELL = 4;
+	// Maximum grid resolution along each axis.
+	static const int MAX_AXIS_RESOLUTION = 1024;
+
+public:
+	// Ctor / Dtor.
+	SpatialIndex();
+	~SpatialIndex();
+
+	// Builds the index over numPoints positions, stored as consecutive x, y, z triples.
+	void Build(const float* points, int numPoints);
+	void Clear();
+
+	int GetNumPoints() { return myNumPoints; }
+
+	// Returns the id of the point closest to the specified position, or -1 if there are no 
+	// points within maxDistance.
+	int FindNearest(float x, float y, float z, float maxDistance = FLT_MAX);
+	// Appends the ids of all the points within radius to result. Returns the number of points found.
+	int FindInRadius(float x, float y, float z, float radius, QVector<int>& result);
+	// Appends the ids of all the points inside the axis aligned box to result. Returns the number of 
+	// points found.
+	int FindInBox(const float* boxMin, const float* boxMax, QVector<int>& result);
+
+private:
+	int GetCellCoord(float value, int axis);
+	int GetCellIndex(int cx, int cy, int cz) { return (cz * myResolution[1] + cy) * myResolution[0] + cx; }
+
+private:
+	int myNumPoints;
+
+	// Grid bounds and resolution.
+	float myMin[3];
+	float myMax[3];
+	float myCellSize[3];
+	int myResolution[3];
+	int myNumCells;
+
+	// Cell i contains points myIds[myCellStart[i]] to myIds[myCellStart[i + 1] - 1]. myPoints stores
+	// the point positions in the same order as myIds, to keep cell scans cache friendly.
+	int* myCellStart;
+	int* myIds;
+	float* myPoints;
+};
+
+#endif
@@ -1,282 +1,451 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "DataSet.h"
-#include "TableView.h"
-#include "VisualizationManager.h"
-
-#include <QFileDialog>
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-TableModel::TableModel(DataSet* data)
-{
-	myData = data;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-int TableModel::rowCount(const QModelIndex& parent) const
-{
-	// If there is some selected data, table view will visualize selected data, otherwise filtered data.
-	if(myData->GetDataLength(DataSet::SelectedData) > 0)
-	{
-		return myData->GetDataLength(DataSet::SelectedData);
-	}
-	return myData->GetDataLength(DataSet::FilteredData);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-int TableModel::columnCount(const QModelIndex& parent) const
-{
-	int c = 0;
-	DataSetInfo* di = myData->GetInfo();
-	for(int i = 0; i < di->GetNumFields(); i++)
-	{
-		if(di->GetField(i)->IsEnabled()) c++;
-	}
-	return c + 1;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-QVariant TableModel::data( const QModelIndex & index, int role) const 
-{
-	if(role == Qt::DisplayRole)
-	{
-		// If there is some selected data, table view will visualize selected data, otherwise filtered data.
-		if(myData->GetDataLength(DataSet::SelectedData) > 0)
-		{
-			int i = index.column();
-			// Print tag1
-			if(i == 0 && myData->GetInfo()->GetTag1Index() != -1)
-			{
-				return QVariant(myData->GetData(index.row(), DataSet::SelectedData)->Tag1);
-			}
-			int c = -1;
-			DataSetInfo* di = myData->GetInfo();
-			for(i = 0; i < di->GetNumFields(); i++)
-			{
-				if(di->GetField(i)->IsEnabled()) c++;
-				if(c == index.column() - 1) break;
-			}			 
-			if(i < di->GetNumFields())
-			{
-				return QVariant((float)myData->GetData(index.row(), DataSet::SelectedData)->Field[i]);
-			}
-			else
-			{
-				return QVariant();
-			}
-		}
-		else
-		{
-			int i = index.column();
-			// Print tag1
-			if(i == 0 && myData->GetInfo()->GetTag1Index() != -1)
-			{
-				return QVariant(myData->GetData(index.row(), DataSet::FilteredData)->Tag1);
-			}
-			int c = -1;
-			DataSetInfo* di = myData->GetInfo();
-			for(i = 0; i < di->GetNumFields(); i++)
-			{
-				if(di->GetField(i)->IsEnabled()) c++;
-				if(c == index.column() - 1) break;
-			}			 
-			if(i < di->GetNumFields())
-			{
-				return QVariant((float)myData->GetData(index.row(), DataSet::FilteredData)->Field[i]);
-			}
-			else
-			{
-				return QVariant();
-			}
-		}
-	}	
-	else
-	{
-	    return QVariant();
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
- QVariant TableModel::headerData(int section, Qt::Orientation orientation, int role) const
- {
-     if (role != Qt::DisplayRole)
-         return QVariant();
-
-	 if (orientation == Qt::Vertical || section >= myData->GetInfo()->GetNumFields())
-	 {
-         return section;
-	 }
-     else
-	 {
-		 // Print tag1
-		 if(section == 0 && myData->GetInfo()->GetTag1Index() != -1)
-		 {
-			 return QString::fromStdString(myData->GetInfo()->GetTag1Label());
-		 }
-		 else
-		 {
-			DataSetInfo* di = myData->GetInfo();
-			int c = -1;
-			int i;
-			for(i = 0; i < di->GetNumFields(); i++)
-			{
-				if(di->GetField(i)->IsEnabled()) c++;
-				if(c == section - 1) break;
-			}			
-			if(i < di->GetNumFields())
-			{
-				return myData->GetFieldName(i);
-			}
-			else
-			{
-				return section;
-			}
-		 }
-	 }
- }
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-Qt::ItemFlags TableModel::flags( const QModelIndex& index ) const
-{
-	return Qt::ItemIsEnabled;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-TableView::TableView(VisualizationManager* mng):
-	DockedTool(mng, QString("Table View"), Qt::BottomDockWidgetArea)
-{
-	myVizMng = mng;
-	GetMenuAction()->setIcon(QIcon(":/icons/TableView.png"));
-
-	myFilter.Enabled = false;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-TableView::~TableView()
-{
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::Initialize()
-{
-	SetupUI();
-	myVizMng->GetDataSet()->AddFilter(&myFilter);
-	myModel = new TableModel(myVizMng->GetDataSet());
-	Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::SetupUI()
-{
-	myUI = new Ui::TableView();
-	myUI->setupUi(GetDockWidget());
-
-	myUI->table->verticalHeader()->setVisible(false);
-
-	connect(myUI->saveCSVButton, SIGNAL(clicked()), this, SLOT(OnSaveAsCSVButtonClick()));
-	connect(myUI->selectAllButton, SIGNAL(clicked()), this, SLOT(OnSelectAllButtonClicked()));
-	connect(myUI->clearAllButton, SIGNAL(clicked()), this, SLOT(OnClearAllButtonClicked()));
-	connect(myUI->chooseColumnsButton, SIGNAL(toggled(bool)), myUI->columnsBox, SLOT(setVisible(bool)));
-
-	DataSet* data = myVizMng->GetDataSet();
-	DataSetInfo* di = data->GetInfo();
-	for(int i = 0; i < di->GetNumFields(); i++)
-	{
-		QCheckBox* cb = new QCheckBox(myUI->columnsBox);
-		myUI->columnsBox->layout()->addWidget(cb);
-
-		cb->setText(di->GetField(i)->GetLabel());
-		cb->setChecked(true);
-
-		connect(cb, SIGNAL(toggled(bool)), this, SLOT(OnColumnCheckedChanged()));
-		myColumnCheckBoxes.push_back(cb);
-	}
-
-	myUI->columnsBox->setVisible(false);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::Update()
-{
-	DataSet* data = myVizMng->GetDataSet();
-	QStringList headers;
-
-	myUI->table->setSelectionBehavior(QAbstractItemView::SelectRows);
-	myUI->table->setModel(NULL);
-	myUI->table->setModel(myModel);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::OnSaveAsCSVButtonClick()
-{
-	QString fileName = QFileDialog::getSaveFileName("./", "*.csv");
-	if(!fileName.isNull())
-	{
-		myVizMng->GetDataSet()->SaveAsCSV(fileName);
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::OnColumnCheckedChanged()
-{
-	DataSet* data = myVizMng->GetDataSet();
-	DataSetInfo* di = data->GetInfo();
-	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
-	{
-		QCheckBox* cb = myColumnCheckBoxes[i];
-		di->GetField(i)->SetEnabled(cb->isChecked());
-	}
-	Update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::OnSelectAllButtonClicked()
-{
-	DataSet* data = myVizMng->GetDataSet();
-	DataSetInfo* di = data->GetInfo();
-	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
-	{
-		QCheckBox* cb = myColumnCheckBoxes[i];
-		cb->setChecked(true);
-	}
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void TableView::OnClearAllButtonClicked()
-{
-	DataSet* data = myVizMng->GetDataSet();
-	DataSetInfo* di = data->GetInfo();
-	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
-	{
-		QCheckBox* cb = myColumnCheckBoxes[i];
-		cb->setChecked(false);
-	}
-}
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "BinaryDataFile.h"
+#include "DataSet.h"
+#include "TableView.h"
+#include "VisualizationManager.h"
+
+#include <QFileDialog>
+#include <QMap>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TableModel::TableModel(DataSet* data):
+	mySubset(DataSet::FilteredData),
+	myNumRows(0),
+	mySorted(false),
+	mySortField(0),
+	mySortOrder(Qt::AscendingOrder),
+	mySortGeneration(0)
+{
+	myData = data;
+	BuildColumnMap();
+	connect(&mySortWatcher, SIGNAL(finished()), SLOT(OnSortFinished()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int TableModel::rowCount(const QModelIndex& parent) const
+{
+	return myNumRows;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int TableModel::columnCount(const QModelIndex& parent) const
+{
+	return myColumnFields.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+QVariant TableModel::data( const QModelIndex & index, int role) const 
+{
+	if((role != Qt::DisplayRole && role != Qt::BackgroundRole) || index.column() >= myColumnFields.size()) 
+	{
+		return QVariant();
+	}
+
+	int row = myRowOrder.isEmpty() ? index.row() : myRowOrder[index.row()];
+	DataItem* item = myData->GetData(row, mySubset);
+	if(role == Qt::BackgroundRole)
+	{
+		// Brushed rows get a highlighted background.
+		if(myData->GetMaskBuffer()[myData->GetRowId(item)] & DataSet::MaskBrushed)
+		{
+			return QBrush(QColor(255, 255, 160));
+		}
+		return QVariant();
+	}
+	int field = myColumnFields[index.column()];
+	if(field == -1)
+	{
+		return QVariant(item->Tag1);
+	}
+	return QVariant((float)item->Field[field]);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ QVariant TableModel::headerData(int section, Qt::Orientation orientation, int role) const
+ {
+     if (role != Qt::DisplayRole)
+         return QVariant();
+
+	 if (orientation == Qt::Vertical || section >= myColumnFields.size())
+	 {
+         return section;
+	 }
+	 // Print tag1
+	 if(myColumnFields[section] == -1)
+	 {
+		 return QString::fromStdString(myData->GetInfo()->GetTag1Label());
+	 }
+	 return myData->GetFieldName(myColumnFields[section]);
+ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+Qt::ItemFlags TableModel::flags( const QModelIndex& index ) const
+{
+	return Qt::ItemIsEnabled;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::BuildColumnMap()
+{
+	DataSetInfo* di = myData->GetInfo();
+	myColumnFields.clear();
+	if(di->GetTag1Index() != -1) myColumnFields.append(-1);
+	for(int i = 0; i < di->GetNumFields(); i++)
+	{
+		if(di->GetField(i)->IsEnabled()) myColumnFields.append(i);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::UpdateColumns()
+{
+	// Fields are rarely toggled: just reset the model.
+	BuildColumnMap();
+	reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::UpdateRows()
+{
+	// If there is some selected data, table view will visualize selected data, otherwise filtered data.
+	DataSet::SubsetType subset = DataSet::FilteredData;
+	if(myData->GetDataLength(DataSet::SelectedData) > 0) subset = DataSet::SelectedData;
+	int numRows = myData->GetDataLength(subset);
+
+	// Keep showing the current row order until the rows are sorted again. If the row count changes, rows past the 
+	// new count are dropped and new rows are appended, so that the order only references existing rows.
+	QVector<int> order;
+	if(!myRowOrder.isEmpty() && numRows != myNumRows)
+	{
+		order.reserve(numRows);
+		for(int i = 0; i < myRowOrder.size(); i++)
+		{
+			if(myRowOrder[i] < numRows) order.append(myRowOrder[i]);
+		}
+		for(int i = myRowOrder.size(); i < numRows; i++) order.append(i);
+	}
+	mySubset = subset;
+
+	if(numRows < myNumRows)
+	{
+		beginRemoveRows(QModelIndex(), numRows, myNumRows - 1);
+		myNumRows = numRows;
+		if(!myRowOrder.isEmpty()) myRowOrder = order;
+		endRemoveRows();
+	}
+	else if(numRows > myNumRows)
+	{
+		beginInsertRows(QModelIndex(), myNumRows, numRows - 1);
+		myNumRows = numRows;
+		if(!myRowOrder.isEmpty()) myRowOrder = order;
+		endInsertRows();
+	}
+	// Views only fetch the visible cells again.
+	if(myNumRows > 0 && myColumnFields.size() > 0)
+	{
+		emit dataChanged(index(0, 0), index(myNumRows - 1, myColumnFields.size() - 1));
+	}
+
+	if(mySorted) StartSort();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::UpdateBrushedRows()
+{
+	if(myNumRows > 0 && myColumnFields.size() > 0)
+	{
+		emit dataChanged(index(0, 0), index(myNumRows - 1, myColumnFields.size() - 1));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::sort(int column, Qt::SortOrder order)
+{
+	if(column < 0 || column >= myColumnFields.size())
+	{
+		mySorted = false;
+		mySortGeneration++;
+		if(!myRowOrder.isEmpty())
+		{
+			emit layoutAboutToBeChanged();
+			myRowOrder.clear();
+			emit layoutChanged();
+		}
+		return;
+	}
+	mySorted = true;
+	mySortField = myColumnFields[column];
+	mySortOrder = order;
+	StartSort();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::StartSort()
+{
+	// Sort keys and tags are gathered here, so that the background sort does not read the dataset. Tags are 
+	// implicitly shared: only references are copied.
+	QVector<SortKey> keys(myNumRows);
+	QVector<QString> tags;
+	if(mySortField == -1)
+	{
+		tags.resize(myNumRows);
+		for(int i = 0; i < myNumRows; i++)
+		{
+			tags[i] = myData->GetData(i, mySubset)->Tag1;
+			keys[i].Row = i;
+		}
+	}
+	else
+	{
+		for(int i = 0; i < myNumRows; i++)
+		{
+			keys[i].Value = myData->GetData(i, mySubset)->Field[mySortField];
+			keys[i].Row = i;
+		}
+	}
+
+	mySortGeneration++;
+	mySortWatcher.setFuture(QtConcurrent::run(&TableModel::SortRows, 
+		keys, tags, mySortOrder == Qt::DescendingOrder, mySortGeneration));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::OnSortFinished()
+{
+	SortResult result = mySortWatcher.result();
+	if(result.Generation != mySortGeneration || result.Order.size() != myNumRows) return;
+
+	emit layoutAboutToBeChanged();
+	myRowOrder = result.Order;
+	emit layoutChanged();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TableModel::SortKeyLess::operator()(const SortKey& a, const SortKey& b) const
+{
+	bool aMissing = a.Value != a.Value;
+	bool bMissing = b.Value != b.Value;
+	if(aMissing != bMissing) return bMissing;
+	if(!aMissing && a.Value != b.Value) return Descending ? a.Value > b.Value : a.Value < b.Value;
+	return a.Row < b.Row;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableModel::SortChunk(SortKey* begin, SortKey* end, bool descending)
+{
+	std::sort(begin, end, SortKeyLess(descending));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TableModel::SortResult TableModel::SortRows(QVector<SortKey> keys, QVector<QString> tags, bool descending, 
+	int generation)
+{
+	int length = keys.size();
+	if(!tags.isEmpty())
+	{
+		// Tags are sorted by their rank among the distinct tags.
+		QMap<QString, int> ranks;
+		for(int i = 0; i < length; i++) ranks.insert(tags[i], 0);
+		int rank = 0;
+		for(QMap<QString, int>::iterator it = ranks.begin(); it != ranks.end(); ++it) it.value() = rank++;
+		for(int i = 0; i < length; i++) keys[i].Value = (float)ranks.value(tags[i]);
+	}
+
+	// Chunks are sorted in parallel, then merged. This runs on a pool thread: it sorts one chunk itself and
+	// leaves the other pool threads to the remaining chunks.
+	int numChunks = qMin(QThread::idealThreadCount(), length / MIN_ROWS_PER_SORT_TASK);
+	if(numChunks < 1) numChunks = 1;
+	int chunkSize = (length + numChunks - 1) / numChunks;
+	SortKey* k = keys.data();
+
+	QList< QFuture<void> > futures;
+	for(int i = 1; i < numChunks; i++)
+	{
+		futures.append(QtConcurrent::run(&TableModel::SortChunk, 
+			k + i * chunkSize, k + qMin(length, (i + 1) * chunkSize), descending));
+	}
+	SortChunk(k, k + qMin(length, chunkSize), descending);
+	for(int i = 0; i < futures.size(); i++) futures[i].waitForFinished();
+
+	for(int merged = chunkSize; merged < length; merged *= 2)
+	{
+		for(int start = 0; start + merged < length; start += merged * 2)
+		{
+			std::inplace_merge(k + start, k + start + merged, k + qMin(length, start + merged * 2), 
+				SortKeyLess(descending));
+		}
+	}
+
+	SortResult result;
+	result.Order.resize(length);
+	for(int i = 0; i < length; i++) result.Order[i] = k[i].Row;
+	result.Generation = generation;
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TableView::TableView(VisualizationManager* mng):
+	DockedTool(mng, QString("Table View"), Qt::BottomDockWidgetArea)
+{
+	myVizMng = mng;
+	GetMenuAction()->setIcon(QIcon(":/icons/TableView.png"));
+
+	myFilter.Enabled = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TableView::~TableView()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::Initialize()
+{
+	SetupUI();
+	myVizMng->GetDataSet()->AddFilter(&myFilter);
+	myVizMng->GetDataSet()->AddListener(this, 
+		DataSet::FilteredChanged | DataSet::SelectionChanged | DataSet::FieldValuesChanged | DataSet::BrushChanged);
+	myModel = new TableModel(myVizMng->GetDataSet());
+
+	// The model is only set once: data changes are notified as row changes.
+	myUI->table->setSelectionBehavior(QAbstractItemView::SelectRows);
+	myUI->table->setModel(myModel);
+	myUI->table->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+	myUI->table->setSortingEnabled(true);
+	Update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::SetupUI()
+{
+	myUI = new Ui::TableView();
+	myUI->setupUi(GetDockWidget());
+
+	myUI->table->verticalHeader()->setVisible(false);
+
+	connect(myUI->saveCSVButton, SIGNAL(clicked()), this, SLOT(OnSaveAsCSVButtonClick()));
+	connect(myUI->selectAllButton, SIGNAL(clicked()), this, SLOT(OnSelectAllButtonClicked()));
+	connect(myUI->clearAllButton, SIGNAL(clicked()), this, SLOT(OnClearAllButtonClicked()));
+	connect(myUI->chooseColumnsButton, SIGNAL(toggled(bool)), myUI->columnsBox, SLOT(setVisible(bool)));
+
+	DataSet* data = myVizMng->GetDataSet();
+	DataSetInfo* di = data->GetInfo();
+	for(int i = 0; i < di->GetNumFields(); i++)
+	{
+		QCheckBox* cb = new QCheckBox(myUI->columnsBox);
+		myUI->columnsBox->layout()->addWidget(cb);
+
+		cb->setText(di->GetField(i)->GetLabel());
+		cb->setChecked(true);
+
+		connect(cb, SIGNAL(toggled(bool)), this, SLOT(OnColumnCheckedChanged()));
+		myColumnCheckBoxes.push_back(cb);
+	}
+
+	myUI->columnsBox->setVisible(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::Update()
+{
+	myModel->UpdateRows();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::OnDataSetChanged(DataSet::ChangeType change, int field)
+{
+	if(change == DataSet::SelectionChanged)
+	{
+		// Only the displayed rows change: notify the row changes right away.
+		myModel->UpdateRows();
+	}
+	else if(change == DataSet::BrushChanged)
+	{
+		// Only the row backgrounds change.
+		myModel->UpdateBrushedRows();
+	}
+	else
+	{
+		myVizMng->RequestUpdate(this);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::OnSaveAsCSVButtonClick()
+{
+	QString fileName = QFileDialog::getSaveFileName("./", "CSV Files (*.csv);;Looking Glass Binary Files (*.lgb)");
+	if(!fileName.isNull())
+	{
+		if(BinaryDataFile::IsBinaryFile(fileName)) myVizMng->GetDataSet()->SaveAsBinary(fileName);
+		else myVizMng->GetDataSet()->SaveAsCSV(fileName);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::OnColumnCheckedChanged()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
+	{
+		QCheckBox* cb = myColumnCheckBoxes[i];
+		data->SetFieldEnabled(i, cb->isChecked());
+	}
+	myModel->UpdateColumns();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::OnSelectAllButtonClicked()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	DataSetInfo* di = data->GetInfo();
+	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
+	{
+		QCheckBox* cb = myColumnCheckBoxes[i];
+		cb->setChecked(true);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TableView::OnClearAllButtonClicked()
+{
+	DataSet* data = myVizMng->GetDataSet();
+	DataSetInfo* di = data->GetInfo();
+	for(int i = 0; i < myColumnCheckBoxes.length(); i++)
+	{
+		QCheckBox* cb = myColumnCheckBoxes[i];
+		cb->setChecked(false);
+	}
+}
@@ -1,71 +1,135 @@
-/********************************************************************************************************************** 
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *---------------------------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com							http://febretpository.hopto.org
- *---------------------------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *********************************************************************************************************************/ 
-#ifndef TABLEVIEW_H
-#define TABLEVIEW_H
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#include "LookingGlassSystem.h"
-#include "DataSet.h"
-#include "DockedTool.h"
-#include "ui_TableView.h"
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class TableModel: public QAbstractTableModel
-{
-	Q_OBJECT
-public:
-	TableModel(DataSet* data);
-
-	int rowCount( const QModelIndex & parent = QModelIndex()) const;
-	int columnCount( const QModelIndex & parent = QModelIndex()) const;
-	QVariant data ( const QModelIndex & index, int role = Qt::DisplayRole ) const ;
-	Qt::ItemFlags flags ( const QModelIndex& index ) const; 
-	QVariant headerData(int section, Qt::Orientation orientation, int role) const;
- 
-private:
-	DataSet* myData;
-};
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class TableView: public DockedTool
-{
-    Q_OBJECT
-
-public:
-    TableView(VisualizationManager* mng);
-    ~TableView();
-
-	void Initialize();
-	void Update();
-
-protected slots:
-	void OnSaveAsCSVButtonClick();
-	void OnColumnCheckedChanged();
-	void OnSelectAllButtonClicked();
-	void OnClearAllButtonClicked();
-
-private:
-	void SetupUI();
-
-private:
-	// UI.
-	Ui::TableView* myUI;
-	VisualizationManager* myVizMng;
-
-	QList<QCheckBox*> myColumnCheckBoxes;
-
-	TableModel* myModel;
-
-	DynamicFilter myFilter;
-};
-
+/********************************************************************************************************************** 
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *---------------------------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com							http://febretpository.hopto.org
+ *---------------------------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *********************************************************************************************************************/ 
+#ifndef TABLEVIEW_H
+#define TABLEVIEW_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+#include "DockedTool.h"
+#include "ui_TableView.h"
+
+#include <QFutureWatcher>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Table over the selected data, or over the filtered data when nothing is selected. The mapping from columns to
+// enabled fields is cached, and rows can be sorted by any column through a row permutation computed in the background.
+class TableModel: public QAbstractTableModel
+{
+	Q_OBJECT
+public:
+	// Minimum number of rows sorted by each parallel sort task.
+	static const int MIN_ROWS_PER_SORT_TASK = 65536;
+
+public:
+	TableModel(DataSet* data);
+
+	int rowCount( const QModelIndex & parent = QModelIndex()) const;
+	int columnCount( const QModelIndex & parent = QModelIndex()) const;
+	QVariant data ( const QModelIndex & index, int role = Qt::DisplayRole ) const ;
+	Qt::ItemFlags flags ( const QModelIndex& index ) const; 
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const;
+	// Starts sorting the rows in the background: rows keep their current order until the sort completes.
+	// A negative column restores the data order.
+	void sort(int column, Qt::SortOrder order = Qt::AscendingOrder);
+
+	// Rebuilds the column map. Must be called after enabling or disabling fields.
+	void UpdateColumns();
+	// Updates the shown subset and notifies attached views of the inserted, removed and changed rows, instead of 
+	// resetting the model. Rows are sorted again if needed, keeping the previous order until the sort completes.
+	void UpdateRows();
+	// Notifies attached views that the brushed rows changed. Brushed rows are shown with a highlighted background.
+	void UpdateBrushedRows();
+
+protected slots:
+	void OnSortFinished();
+
+private:
+	struct SortKey
+	{
+		float Value;
+		int Row;
+	};
+	// Orders sort keys by value, with missing values last. Equal values keep the row order.
+	struct SortKeyLess
+	{
+		SortKeyLess(bool descending): Descending(descending) {}
+		bool operator()(const SortKey& a, const SortKey& b) const;
+		bool Descending;
+	};
+	struct SortResult
+	{
+		QVector<int> Order;
+		int Generation;
+	};
+
+private:
+	void BuildColumnMap();
+	void StartSort();
+	// Sorts the keys. If tags are specified, key values are first set to the rank of the row tags.
+	static SortResult SortRows(QVector<SortKey> keys, QVector<QString> tags, bool descending, int generation);
+	static void SortChunk(SortKey* begin, SortKey* end, bool descending);
+
+private:
+	DataSet* myData;
+	DataSet::SubsetType mySubset;
+	int myNumRows;
+	// Field shown by each column, -1 for the tag column.
+	QVector<int> myColumnFields;
+
+	// Sorting. The sort field is stored instead of the column, so that toggling fields keeps the row order.
+	bool mySorted;
+	int mySortField;
+	Qt::SortOrder mySortOrder;
+	// Subset row shown by each table row, empty for the data order.
+	QVector<int> myRowOrder;
+	// Incremented every time a sort is started or cancelled, to drop outdated sort results.
+	int mySortGeneration;
+	QFutureWatcher<SortResult> mySortWatcher;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TableView: public DockedTool, public DataSetListener
+{
+    Q_OBJECT
+
+public:
+    TableView(VisualizationManager* mng);
+    ~TableView();
+
+	void Initialize();
+	void Update();
+	// The table depends on the filtered data, the selection, the field values and the brushes.
+	void OnDataSetChanged(DataSet::ChangeType change, int field);
+
+protected slots:
+	void OnSaveAsCSVButtonClick();
+	void OnColumnCheckedChanged();
+	void OnSelectAllButtonClicked();
+	void OnClearAllButtonClicked();
+
+private:
+	void SetupUI();
+
+private:
+	// UI.
+	Ui::TableView* myUI;
+	VisualizationManager* myVizMng;
+
+	QList<QCheckBox*> myColumnCheckBoxes;
+
+	TableModel* myModel;
+
+	DynamicFilter myFilter;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "TimePyramid.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+const int TimePyramid::BucketSeconds[TimePyramid::NumLevels] = { 60, 60 * 60, 24 * 60 * 60 };
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TimePyramid::Build(const time_t* times, const float* values, int length)
+{
+	myValues.resize(length);
+	for(int i = 0; i < length; i++) myValues[i] = values[i];
+
+	// Minute buckets are built from the samples. Means are accumulated in double precision.
+	QVector<Bucket>& minutes = myLevels[Minute];
+	minutes.clear();
+	double sum = 0;
+	for(int i = 0; i < length; i++)
+	{
+		float value = values[i];
+		if(value != value) continue;
+
+		time_t start = GetBucketStart(times[i], BucketSeconds[Minute]);
+		if(minutes.isEmpty() || minutes.last().Start != start)
+		{
+			if(!minutes.isEmpty()) minutes.last().Mean = (float)(sum / minutes.last().Count);
+			Bucket bucket;
+			bucket.Start = start;
+			bucket.Min = value;
+			bucket.Max = value;
+			bucket.Count = 0;
+			minutes.append(bucket);
+			sum = 0;
+		}
+		Bucket& bucket = minutes.last();
+		if(value < bucket.Min) bucket.Min = value;
+		if(value > bucket.Max) bucket.Max = value;
+		bucket.Count++;
+		sum += value;
+	}
+	if(!minutes.isEmpty()) minutes.last().Mean = (float)(sum / minutes.last().Count);
+
+	// Coarser levels are built from the level below.
+	for(int level = Hour; level < NumLevels; level++)
+	{
+		Aggregate(myLevels[level - 1], BucketSeconds[level], myLevels[level]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void TimePyramid::Aggregate(const QVector<Bucket>& src, int seconds, QVector<Bucket>& dst)
+{
+	dst.clear();
+	double sum = 0;
+	for(int i = 0; i < src.size(); i++)
+	{
+		const Bucket& b = src[i];
+		time_t start = GetBucketStart(b.Start, seconds);
+		if(dst.isEmpty() || dst.last().Start != start)
+		{
+			if(!dst.isEmpty()) dst.last().Mean = (float)(sum / dst.last().Count);
+			Bucket bucket = b;
+			bucket.Start = start;
+			bucket.Count = 0;
+			dst.append(bucket);
+			sum = 0;
+		}
+		Bucket& bucket = dst.last();
+		if(b.Min < bucket.Min) bucket.Min = b.Min;
+		if(b.Max > bucket.Max) bucket.Max = b.Max;
+		bucket.Count += b.Count;
+		sum += (double)b.Mean * b.Count;
+	}
+	if(!dst.isEmpty()) dst.last().Mean = (float)(sum / dst.last().Count);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int TimePyramid::FindBucket(int level, time_t t)
+{
+	const QVector<Bucket>& buckets = myLevels[level];
+	int seconds = BucketSeconds[level];
+	int lo = 0;
+	int hi = buckets.size();
+	while(lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+		if(buckets[mid].Start + seconds <= t) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+time_t TimePyramid::GetBucketStart(time_t t, int seconds)
+{
+	time_t r = t % seconds;
+	return r < 0 ? t - r - seconds : t - r;
+}
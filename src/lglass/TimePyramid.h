@@ -0,0 +1,81 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef TIMEPYRAMID_H
+#define TIMEPYRAMID_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+
+#include <time.h>
+#include <QVector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Minimum, maximum and mean of a field over fixed length time buckets, at several resolutions. Used
+// to plot a field against time with a bounded number of points whatever the time span.
+class TimePyramid
+{
+public:
+	enum Level { Minute, Hour, Day, NumLevels };
+	// Bucket length in seconds for each level.
+	static const int BucketSeconds[NumLevels];
+
+	struct Bucket
+	{
+		time_t Start;
+		float Min;
+		float Max;
+		float Mean;
+		int Count;
+	};
+
+public:
+	// Builds the pyramid from length values sorted by time. Missing (NaN) values are skipped by the
+	// aggregated levels.
+	void Build(const time_t* times, const float* values, int length);
+
+	// Returns the values sorted by time, that is the full resolution level.
+	const QVector<float>& GetValues() { return myValues; }
+	// Returns the non empty buckets of a level, sorted by time.
+	const QVector<Bucket>& GetBuckets(int level) { return myLevels[level]; }
+	// Returns the index of the first bucket of a level ending after t.
+	int FindBucket(int level, time_t t);
+
+private:
+	static time_t GetBucketStart(time_t t, int seconds);
+	// Builds a level by merging the buckets of the finer level src.
+	static void Aggregate(const QVector<Bucket>& src, int seconds, QVector<Bucket>& dst);
+
+private:
+	QVector<float> myValues;
+	QVector<Bucket> myLevels[NumLevels];
+};
+
+#endif
@@ -0,0 +1,227 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "VtkDataBuilder.h"
+
+#include <vtkIdTypeArray.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+VtkDataBuilder::VtkDataBuilder():
+	myQuit(false)
+{
+	for(int i = 0; i < NUM_SUBSETS; i++)
+	{
+		myJobs[i].Pending = false;
+		myJobs[i].Generation = 0;
+		myResults[i].Connectivity = NULL;
+		myResults[i].NumVerts = 0;
+		myResults[i].Generation = 0;
+		myFreeBuffers[i] = NULL;
+		myGeneration[i] = 0;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+VtkDataBuilder::~VtkDataBuilder()
+{
+	myMutex.lock();
+	myQuit = true;
+	myWakeup.wakeAll();
+	myMutex.unlock();
+
+	wait();
+
+	for(int i = 0; i < NUM_SUBSETS; i++)
+	{
+		if(myResults[i].Connectivity != NULL) myResults[i].Connectivity->Delete();
+		if(myFreeBuffers[i] != NULL) myFreeBuffers[i]->Delete();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int VtkDataBuilder::Request(DataSet::SubsetType subset, const unsigned char* mask, int length, unsigned char bit, int subsetLength, int step)
+{
+	int slot = GetSlot(subset);
+
+	// Snapshot the mask outside of the lock: the dataset may change it again while the build runs.
+	QByteArray maskCopy((const char*)mask, length);
+
+	QMutexLocker lock(&myMutex);
+	myGeneration[slot]++;
+
+	Job& job = myJobs[slot];
+	job.Pending = true;
+	job.Generation = myGeneration[slot];
+	job.Mask = maskCopy;
+	job.Bit = bit;
+	job.SubsetLength = subsetLength;
+	job.Step = step > 0 ? step : 1;
+
+	if(!isRunning()) start(QThread::LowPriority);
+	myWakeup.wakeAll();
+
+	return job.Generation;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+vtkIdTypeArray* VtkDataBuilder::TakeResult(DataSet::SubsetType subset, int* numVerts)
+{
+	int slot = GetSlot(subset);
+
+	QMutexLocker lock(&myMutex);
+	Result& result = myResults[slot];
+	if(result.Connectivity == NULL || result.Generation != myGeneration[slot]) return NULL;
+
+	vtkIdTypeArray* conn = result.Connectivity;
+	*numVerts = result.NumVerts;
+	result.Connectivity = NULL;
+	return conn;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataBuilder::Recycle(DataSet::SubsetType subset, vtkIdTypeArray* buffer)
+{
+	int slot = GetSlot(subset);
+
+	QMutexLocker lock(&myMutex);
+	if(myFreeBuffers[slot] == NULL)
+	{
+		myFreeBuffers[slot] = buffer;
+	}
+	else
+	{
+		buffer->Delete();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool VtkDataBuilder::IsStale(int slot, int generation)
+{
+	QMutexLocker lock(&myMutex);
+	return myQuit || myGeneration[slot] != generation;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataBuilder::run()
+{
+	while(true)
+	{
+		// Wait for the next job.
+		myMutex.lock();
+		int slot = -1;
+		while(!myQuit && slot == -1)
+		{
+			for(int i = 0; i < NUM_SUBSETS; i++)
+			{
+				if(myJobs[i].Pending)
+				{
+					slot = i;
+					break;
+				}
+			}
+			if(slot == -1) myWakeup.wait(&myMutex);
+		}
+		if(myQuit)
+		{
+			myMutex.unlock();
+			return;
+		}
+
+		Job job = myJobs[slot];
+		myJobs[slot].Pending = false;
+		myJobs[slot].Mask = QByteArray();
+
+		// Get a back buffer.
+		vtkIdTypeArray* conn = myFreeBuffers[slot];
+		myFreeBuffers[slot] = NULL;
+		myMutex.unlock();
+
+		if(conn == NULL) conn = vtkIdTypeArray::New();
+
+		int numVerts = 0;
+		bool done = Build(slot, job, conn, &numVerts);
+
+		myMutex.lock();
+		if(done && myGeneration[slot] == job.Generation)
+		{
+			// Publish the result, dropping any older result that was never collected.
+			Result& result = myResults[slot];
+			if(result.Connectivity != NULL)
+			{
+				if(myFreeBuffers[slot] == NULL) myFreeBuffers[slot] = result.Connectivity;
+				else result.Connectivity->Delete();
+			}
+			result.Connectivity = conn;
+			result.NumVerts = numVerts;
+			result.Generation = job.Generation;
+			myMutex.unlock();
+
+			emit BuildDone(slot == 0 ? DataSet::FilteredData : DataSet::SelectedData, job.Generation);
+		}
+		else
+		{
+			// The build was cancelled: keep the buffer for the next job.
+			if(myFreeBuffers[slot] == NULL) myFreeBuffers[slot] = conn;
+			else conn->Delete();
+			myMutex.unlock();
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool VtkDataBuilder::Build(int slot, const Job& job, vtkIdTypeArray* conn, int* numVerts)
+{
+	int maxVerts = (job.SubsetLength + job.Step - 1) / job.Step;
+	conn->SetNumberOfValues(maxVerts * 2);
+	vtkIdType* ids = conn->GetPointer(0);
+
+	const unsigned char* mask = (const unsigned char*)job.Mask.constData();
+	int length = job.Mask.size();
+	int v = 0;
+	int c = 0;
+	for(int i = 0; i < length && v < maxVerts; i++)
+	{
+		if(mask[i] & job.Bit)
+		{
+			if(c % job.Step == 0)
+			{
+				ids[v * 2] = 1;
+				ids[v * 2 + 1] = i;
+				v++;
+			}
+			c++;
+		}
+		if(i % CANCEL_CHECK_INTERVAL == 0 && IsStale(slot, job.Generation)) return false;
+	}
+
+	conn->SetNumberOfValues(v * 2);
+	*numVerts = v;
+	return true;
+}
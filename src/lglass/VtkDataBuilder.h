@@ -0,0 +1,110 @@
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#ifndef VTKDATABUILDER_H
+#define VTKDATABUILDER_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+
+#include <QByteArray>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Builds the vertex connectivity of the filtered and selected point sets on a worker thread. Each
+// request takes a snapshot of the dataset subset mask and gets a new generation number. Builds are
+// written into a back buffer and cancelled as soon as a newer request for the same subset arrives. 
+// When a build completes the BuildDone signal is raised, and the result can be collected on the GUI
+// thread with TakeResult.
+class VtkDataBuilder: public QThread
+{
+	Q_OBJECT
+public:
+	// Number of subsets the builder handles (filtered and selected data).
+	static const int NUM_SUBSETS = 2;
+	// Number of mask items processed between cancellation checks.
+	static const int CANCEL_CHECK_INTERVAL = 65536;
+
+public:
+	VtkDataBuilder();
+	~VtkDataBuilder();
+
+	// Queues a vertex build for the specified subset, replacing any pending or in flight build for
+	// the same subset. Returns the request generation.
+	int Request(DataSet::SubsetType subset, const unsigned char* mask, int length, unsigned char bit, int subsetLength, int step);
+	// Returns the completed connectivity array for the specified subset, or NULL if the latest build 
+	// is not ready yet. Ownership of the array is passed to the caller.
+	vtkIdTypeArray* TakeResult(DataSet::SubsetType subset, int* numVerts);
+	// Gives back a connectivity array that is no longer in use, so it can be reused as a back buffer.
+	void Recycle(DataSet::SubsetType subset, vtkIdTypeArray* buffer);
+
+signals:
+	void BuildDone(int subset, int generation);
+
+protected:
+	virtual void run();
+
+private:
+	struct Job
+	{
+		bool Pending;
+		int Generation;
+		QByteArray Mask;
+		unsigned char Bit;
+		int SubsetLength;
+		int Step;
+	};
+
+	struct Result
+	{
+		vtkIdTypeArray* Connectivity;
+		int NumVerts;
+		int Generation;
+	};
+
+	int GetSlot(DataSet::SubsetType subset) { return subset == DataSet::FilteredData ? 0 : 1; }
+	bool Build(int slot, const Job& job, vtkIdTypeArray* conn, int* numVerts);
+	bool IsStale(int slot, int generation);
+
+private:
+	QMutex myMutex;
+	QWaitCondition myWakeup;
+	bool myQuit;
+
+	Job myJobs[NUM_SUBSETS];
+	Result myResults[NUM_SUBSETS];
+	vtkIdTypeArray* myFreeBuffers[NUM_SUBSETS];
+	int myGeneration[NUM_SUBSETS];
+};
+
+#endif
@@ -1,106 +1,191 @@
-/**************************************************************************************************
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *-------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com		http://febretpository.hopto.org
- *-------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *-------------------------------------------------------------------------------------------------
- * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
- * All rights reserved.
- * Redistribution and use in source and binary forms, with or without modification, are permitted 
- * provided that the following conditions are met:
- * 
- * Redistributions of source code must retain the above copyright notice, this list of conditions 
- * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
- * notice, this list of conditions and the following disclaimer in the documentation and/or other 
- * materials provided with the distribution. 
- * 
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
- * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
- * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
- * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
- * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *************************************************************************************************/ 
-#include "VtkDataManager.h"
-#include "DataSet.h"
-#include "DataSetInfo.h"
-
-#include <vtkFloatArray.h>
-#include <vtkPointData.h>
-#include <vtkPointSet.h>
-#include <vtkUnstructuredGrid.h>
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-VtkDataManager* VtkDataManager::myInstance = NULL;
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void VtkDataManager::Initialize(DataSet* dataSet)
-{
-	myInstance = new VtkDataManager(dataSet);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-VtkDataManager::VtkDataManager(DataSet* dataSet)
-{
-	myDataSet = dataSet;
-
-	myVtkData = vtkUnstructuredGrid::New();
-	mySelectedVtkData = vtkUnstructuredGrid::New();
-	myFilteredVtkData = vtkUnstructuredGrid::New();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-void VtkDataManager::Update(DataSet::SubsetType subset)
-{
-	DataSetInfo* info = myDataSet->GetInfo();
-
-	vtkPointSet* pset = GetPointSet(subset);
-	pset->Modified();
-
-	int l = myDataSet->GetDataLength(subset);
-
-	vtkPoints* pts = vtkPoints::New();
-	pts->SetNumberOfPoints(l);
-	pset->SetPoints(pts);
-
-	vtkFloatArray* fields[DataSetInfo::MAX_FIELDS]; 
-	for(int i = 0; i < info->GetNumFields(); i++)
-	{
-		fields[i] = vtkFloatArray::New();
-		fields[i]->Allocate(l);
-		fields[i]->SetName(myDataSet->GetFieldName(i));
-		pset->GetPointData()->AddArray(fields[i]);
-	}
-
-	for(int i = 0; i < l; i++)
-	{
-		DataItem* d = myDataSet->GetData(i, subset);
-		pts->SetPoint(i, d->Y, d->Z, d->X);
-
-		for(int j = 0; j < info->GetNumFields(); j++)
-		{
-			fields[j]->InsertValue(i, d->Field[j]);
-		}
-	}
-
-	//pset->GetPointData()->SetActiveScalars(GetFieldName(0));
-
-	// Delete temporary objects.
-	for(int i = 0; i < info->GetNumFields(); i++) fields[i]->Delete();
-	pts->Delete();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-vtkPointSet* VtkDataManager::GetPointSet(DataSet::SubsetType subset)
-{
-	if(subset == DataSet::AllData) return myVtkData;
-	else if(subset == DataSet::FilteredData) return myFilteredVtkData;
-	return mySelectedVtkData;
-}
+/**************************************************************************************************
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *-------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti		Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com		http://febretpository.hopto.org
+ *-------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *-------------------------------------------------------------------------------------------------
+ * Copyright (c) 2010-2011, Electronic Visualization Laboratory, University of Illinois at Chicago
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice, this list of conditions 
+ * and the following disclaimer. Redistributions in binary form must reproduce the above copyright 
+ * notice, this list of conditions and the following disclaimer in the documentation and/or other 
+ * materials provided with the distribution. 
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR 
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE  GOODS OR SERVICES; LOSS OF 
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN 
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *************************************************************************************************/ 
+#include "VtkDataManager.h"
+#include "VtkDataBuilder.h"
+#include "DataSet.h"
+#include "DataSetInfo.h"
+
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkPointData.h>
+#include <vtkPointSet.h>
+#include <vtkPolyData.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+VtkDataManager* VtkDataManager::myInstance = NULL;
+const char* VtkDataManager::RowIdArrayName = "RowId";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataManager::Initialize(DataSet* dataSet)
+{
+	myInstance = new VtkDataManager(dataSet);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+VtkDataManager::VtkDataManager(DataSet* dataSet):
+	myPointReductionFactor(1)
+{
+	myDataSet = dataSet;
+
+	myVtkData = vtkPolyData::New();
+	mySelectedVtkData = vtkPolyData::New();
+
+	myBuilder = new VtkDataBuilder();
+	connect(myBuilder, SIGNAL(BuildDone(int, int)), SLOT(OnBuildDone(int, int)), Qt::QueuedConnection);
+
+	// The selected subset references the full dataset points through its vertex cells.
+	vtkCellArray* verts = vtkCellArray::New();
+	mySelectedVtkData->SetVerts(verts);
+	verts->Delete();
+
+	for(int i = 0; i < 3; i++) myUpdateLatency[i] = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataManager::Update(DataSet::SubsetType subset)
+{
+	if(subset == DataSet::AllData) UpdateAllData();
+	else UpdateSubset(subset);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataManager::UpdateAllData()
+{
+	DataSetInfo* info = myDataSet->GetInfo();
+
+	int l = myDataSet->GetDataLength(DataSet::AllData);
+
+	// Wrap the dataset position buffer. The last SetArray argument (save = 1) tells vtk not to 
+	// free the memory, which is still owned by the dataset.
+	vtkFloatArray* positions = vtkFloatArray::New();
+	positions->SetNumberOfComponents(3);
+	positions->SetArray(myDataSet->GetPositionBuffer(), l * 3, 1);
+
+	vtkPoints* pts = vtkPoints::New();
+	pts->SetData(positions);
+	myVtkData->SetPoints(pts);
+
+	vtkPointData* pd = myVtkData->GetPointData();
+	for(int i = 0; i < info->GetNumFields(); i++)
+	{
+		vtkFloatArray* field = vtkFloatArray::New();
+		field->SetArray(myDataSet->GetFieldColumn(i), l, 1);
+		field->SetName(myDataSet->GetFieldName(i));
+		pd->AddArray(field);
+		field->Delete();
+	}
+
+	// Row ids map each point back to its item in the full dataset. Point filters pass them through,
+	// so picked points can be resolved without searching the data.
+	vtkIdTypeArray* rowIds = vtkIdTypeArray::New();
+	rowIds->SetNumberOfValues(l);
+	rowIds->SetName(RowIdArrayName);
+	for(int i = 0; i < l; i++) rowIds->SetValue(i, i);
+	pd->AddArray(rowIds);
+
+	myVtkData->Modified();
+
+	// The selected subset shares the full dataset points and arrays.
+	mySelectedVtkData->SetPoints(pts);
+	mySelectedVtkData->GetPointData()->ShallowCopy(pd);
+
+	// Delete temporary objects.
+	rowIds->Delete();
+	positions->Delete();
+	pts->Delete();
+
+	UpdateSubset(DataSet::FilteredData);
+	UpdateSubset(DataSet::SelectedData);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataManager::UpdateSubset(DataSet::SubsetType subset)
+{
+	// The filtered subset mask is read directly by the level of detail selection.
+	if(subset == DataSet::FilteredData)
+	{
+		myUpdateLatency[subset] = 0;
+		emit SubsetUpdated(subset);
+		return;
+	}
+
+	// The current vertices stay in use until the builder thread delivers the new ones.
+	myUpdateTimer[subset].start();
+	myBuilder->Request(subset, 
+		myDataSet->GetMaskBuffer(), myDataSet->GetDataLength(DataSet::AllData), DataSet::MaskSelected, 
+		myDataSet->GetDataLength(subset), myPointReductionFactor);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void VtkDataManager::OnBuildDone(int subset, int generation)
+{
+	int numVerts = 0;
+	vtkIdTypeArray* connectivity = myBuilder->TakeResult((DataSet::SubsetType)subset, &numVerts);
+
+	// A newer build has been requested, or the result has been collected already.
+	if(connectivity == NULL) return;
+
+	vtkPolyData* poly = mySelectedVtkData;
+
+	// Swap the new vertices in. The old connectivity goes back to the builder only if nothing else
+	// (i.e. a shallow copy made by a pipeline stage) still references it, since the worker thread 
+	// writes into recycled buffers.
+	vtkCellArray* verts = poly->GetVerts();
+	vtkIdTypeArray* oldConnectivity = verts->GetData();
+	oldConnectivity->Register(NULL);
+	verts->SetCells(numVerts, connectivity);
+	connectivity->Delete();
+	if(oldConnectivity->GetReferenceCount() == 1) myBuilder->Recycle((DataSet::SubsetType)subset, oldConnectivity);
+	else oldConnectivity->Delete();
+
+	// Drop the cell links built for picking, they refer to the old vertices.
+	poly->DeleteCells();
+	poly->Modified();
+
+	myUpdateLatency[subset] = myUpdateTimer[subset].elapsed();
+
+	emit SubsetUpdated(subset);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+vtkPointSet* VtkDataManager::GetPointSet(DataSet::SubsetType subset)
+{
+	return GetPolyData(subset);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+vtkPolyData* VtkDataManager::GetPolyData(DataSet::SubsetType subset)
+{
+	if(subset == DataSet::AllData) return myVtkData;
+	else if(subset == DataSet::SelectedData) return mySelectedVtkData;
+	return NULL;
+}
@@ -1,44 +1,84 @@
-/********************************************************************************************************************** 
- * THE LOOKING GLASS VISUALIZATION TOOLSET
- *---------------------------------------------------------------------------------------------------------------------
- * Author: 
- *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
- * Contact & Web:
- *  febret@gmail.com							http://febretpository.hopto.org
- *---------------------------------------------------------------------------------------------------------------------
- * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
- * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
- *********************************************************************************************************************/ 
-#ifndef VTKDATAMANAGER_H
-#define VTKDATAMANAGER_H
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#include "LookingGlassSystem.h"
-#include "DataSet.h"
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class VtkDataManager
-{
-public:
-	// Singleton stuff.
-	static void Initialize(DataSet* dataSet);
-	static VtkDataManager* GetInstance() { return myInstance; }
-
-	void Update(DataSet::SubsetType subset);
-	vtkPointSet* GetPointSet(DataSet::SubsetType subset);
-
-private:
-	VtkDataManager(DataSet* dataSet);
-
-	// Singleton instance.
-	static VtkDataManager* myInstance;
-
-	DataSet* myDataSet;
-
-	// Data.
-	vtkUnstructuredGrid* myVtkData;
-	vtkUnstructuredGrid* myFilteredVtkData;
-	vtkUnstructuredGrid* mySelectedVtkData;
-};
-
+/********************************************************************************************************************** 
+ * THE LOOKING GLASS VISUALIZATION TOOLSET
+ *---------------------------------------------------------------------------------------------------------------------
+ * Author: 
+ *	Alessandro Febretti							Electronic Visualization Laboratory, University of Illinois at Chicago
+ * Contact & Web:
+ *  febret@gmail.com							http://febretpository.hopto.org
+ *---------------------------------------------------------------------------------------------------------------------
+ * Looking Glass has been built as part of the ENDURANCE Project (http://www.evl.uic.edu/endurance/).
+ * ENDURANCE is supported by the NASA ASTEP program under Grant NNX07AM88G and by the NSF USAP.
+ *********************************************************************************************************************/ 
+#ifndef VTKDATAMANAGER_H
+#define VTKDATAMANAGER_H
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "LookingGlassSystem.h"
+#include "DataSet.h"
+
+#include <QTime>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class VtkDataManager: public QObject
+{
+	Q_OBJECT
+public:
+	// Name of the point array storing the dataset row index of each point.
+	static const char* RowIdArrayName;
+
+public:
+	// Singleton stuff.
+	static void Initialize(DataSet* dataSet);
+	static VtkDataManager* GetInstance() { return myInstance; }
+
+	// Updates the vtk representation of a data subset. The full dataset representation is built once
+	// and wraps the dataset column storage without copying it. The selected subset shares points and
+	// point data with it: updating it only rebuilds its vertex cells from the dataset subset mask, on
+	// a worker thread. The SubsetUpdated signal is raised when the new vertices have been swapped in.
+	// The filtered subset is drawn by the sonde level of detail straight from the subset mask, so it
+	// has no vertex cells: SubsetUpdated is raised as soon as it is updated.
+	void Update(DataSet::SubsetType subset);
+	vtkPointSet* GetPointSet(DataSet::SubsetType subset);
+	// Returns the point cloud for the full dataset or the selected subset (NULL for the filtered subset).
+	// The selected point cloud stores a prebuilt vertex cell array, so it can be rendered directly by a
+	// vtkPolyDataMapper.
+	vtkPolyData* GetPolyData(DataSet::SubsetType subset);
+
+	// Returns the time in milliseconds between the last update request for a subset and the moment
+	// its new vertices were swapped in.
+	int GetLastUpdateLatency(DataSet::SubsetType subset) { return myUpdateLatency[subset]; }
+
+	// Gets or sets the point reduction factor used when building vertices for the filtered and 
+	// selected subsets: only one every N items is kept.
+	void SetPointReductionFactor(int value) { myPointReductionFactor = value; }
+	int GetPointReductionFactor() { return myPointReductionFactor; }
+
+signals:
+	void SubsetUpdated(int subset);
+
+protected slots:
+	void OnBuildDone(int subset, int generation);
+
+private:
+	VtkDataManager(DataSet* dataSet);
+
+	void UpdateAllData();
+	void UpdateSubset(DataSet::SubsetType subset);
+
+	// Singleton instance.
+	static VtkDataManager* myInstance;
+
+	DataSet* myDataSet;
+	int myPointReductionFactor;
+	VtkDataBuilder* myBuilder;
+
+	// Update latency measurement.
+	QTime myUpdateTimer[3];
+	int myUpdateLatency[3];
+
+	// Data.
+	vtkPolyData* myVtkData;
+	vtkPolyData* mySelectedVtkData;
+};
+
 #endif
\ No newline at end of file